@@ -12,7 +12,9 @@
 #endif
 
 typedef unsigned char ak_json_u8;
+typedef unsigned int ak_json_u32;
 typedef unsigned long long ak_json_u64;
+typedef long long ak_json_s64;
 typedef ak_json_u64 ak_json_user_data;
 
 typedef enum ak_json_error_code
@@ -21,7 +23,9 @@ typedef enum ak_json_error_code
     AK_JSON_ERROR_CODE_OUT_OF_MEMORY,
     AK_JSON_ERROR_CODE_UNDEFINED_TOKEN,
     AK_JSON_ERROR_CODE_EXPECTED_END_OF_STREAM,
-    AK_JSON_ERROR_CODE_ARRAY_PARSING
+    AK_JSON_ERROR_CODE_ARRAY_PARSING,
+    AK_JSON_ERROR_CODE_OBJECT_PARSING,
+    AK_JSON_ERROR_CODE_POINTER_PARSING
 } ak_json_error_code;
 
 typedef enum ak_json_value_type
@@ -48,8 +52,39 @@ typedef struct ak_json_key       ak_json_key;
 typedef struct ak_json_value     ak_json_value;
 typedef struct ak_json_array     ak_json_array;
 typedef struct ak_json_object    ak_json_object;
+typedef struct ak_json_tape      ak_json_tape;
+typedef struct ak_json_pointer   ak_json_pointer;
+typedef struct ak_json_document  ak_json_document;
 
-typedef void* ak_json_alloc(ak_json_allocator* Allocator, unsigned int Size);
+//NOTE(EVERYONE): A cursor is a position in a tape. It is small enough to pass around by value
+typedef struct ak_json_cursor
+{
+    ak_json_tape* Tape;
+    ak_json_u64   Index;
+} ak_json_cursor;
+
+//NOTE(EVERYONE): A lazy value is a position in the raw input. Nothing is parsed until it is asked for
+typedef struct ak_json_lazy
+{
+    ak_json_context*   Context;
+    ak_json_str        Str;
+    ak_json_u64        Index;
+    ak_json_value_type Parent;
+    int                IsKey;
+} ak_json_lazy;
+
+//NOTE(EVERYONE): Allocation sizes are 64 bit. Allocators written against the old unsigned int callback 
+//can define AK_JSON_ALLOCATOR_32 to keep compiling unchanged, in which case any allocation that does not 
+//fit in 32 bits fails as out of memory
+#define AK_JSON_ALLOCATOR_VERSION 2
+
+#ifdef AK_JSON_ALLOCATOR_32
+typedef unsigned int ak_json_size;
+#else
+typedef ak_json_u64 ak_json_size;
+#endif
+
+typedef void* ak_json_alloc(ak_json_allocator* Allocator, ak_json_size Size);
 typedef void  ak_json_free(ak_json_allocator* Allocator, void* Memory);
 
 typedef struct ak_json_allocator
@@ -63,12 +98,20 @@ AK_JSON_DEF ak_json_str AK_Json_Str_Create(const ak_json_u8* Str, ak_json_u64 Le
 
 AK_JSON_DEF ak_json_context*   AK_Json_Create(ak_json_allocator* Allocator);
 AK_JSON_DEF void               AK_Json_Delete(ak_json_context* Context);
+AK_JSON_DEF void               AK_Json_Context_Reset(ak_json_context* Context, ak_json_u64 MaxSize);
 
 AK_JSON_DEF ak_json_error_code AK_Json_Get_Error_Code();
 AK_JSON_DEF ak_json_str        AK_Json_Get_Error_Message();
 
 AK_JSON_DEF ak_json_value* AK_Json_Parse(ak_json_context* Context, ak_json_str Str);
 
+AK_JSON_DEF ak_json_document* AK_Json_Parse_Document(ak_json_context* Context, ak_json_str Str);
+AK_JSON_DEF ak_json_value*    AK_Json_Document_Get_Root(ak_json_document* Document);
+AK_JSON_DEF void              AK_Json_Document_Free(ak_json_document* Document);
+
+AK_JSON_DEF ak_json_value* AK_Json_Parse_Into(void* Buffer, ak_json_u64 Capacity, ak_json_str Str);
+AK_JSON_DEF ak_json_u64    AK_Json_Max_Memory_For_Input(ak_json_u64 Length);
+
 AK_JSON_DEF ak_json_str    AK_Json_Key_Get_Name(ak_json_key* Key);
 AK_JSON_DEF ak_json_value* AK_Json_Key_Get_Value(ak_json_key* Key);
 
@@ -76,6 +119,9 @@ AK_JSON_DEF ak_json_value_type AK_Json_Value_Get_Type(ak_json_value* Value);
 AK_JSON_DEF ak_json_str        AK_Json_Value_Get_String(ak_json_value* Value);
 AK_JSON_DEF int                AK_Json_Value_Get_Boolean(ak_json_value* Value);
 AK_JSON_DEF double             AK_Json_Value_Get_Number(ak_json_value* Value);
+AK_JSON_DEF int                AK_Json_Value_Is_Integer(ak_json_value* Value);
+AK_JSON_DEF ak_json_s64        AK_Json_Value_Get_Int64(ak_json_value* Value);
+AK_JSON_DEF ak_json_u64        AK_Json_Value_Get_Uint64(ak_json_value* Value);
 AK_JSON_DEF ak_json_array*     AK_Json_Value_Get_Array(ak_json_value* Value);
 AK_JSON_DEF ak_json_object*    AK_Json_Value_Get_Object(ak_json_value* Value);
 
@@ -85,6 +131,86 @@ AK_JSON_DEF ak_json_value*   AK_Json_Array_Get_Value(ak_json_array* Array, unsig
 AK_JSON_DEF unsigned int AK_Json_Object_Get_Key_Count(ak_json_object* Object);
 AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key_By_Index(ak_json_object* Object, unsigned int Index);
 AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key(ak_json_object* Object, ak_json_str Key);
+AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key_Hashed(ak_json_object* Object, ak_json_str Key, ak_json_u64 Hash);
+AK_JSON_DEF ak_json_u64  AK_Json_Hash_Str(ak_json_str Str);
+
+AK_JSON_DEF ak_json_tape*  AK_Json_Parse_Tape(ak_json_context* Context, ak_json_str Str);
+AK_JSON_DEF ak_json_cursor AK_Json_Tape_Get_Root(ak_json_tape* Tape);
+
+AK_JSON_DEF int                AK_Json_Cursor_Is_Valid(ak_json_cursor Cursor);
+AK_JSON_DEF ak_json_value_type AK_Json_Cursor_Get_Type(ak_json_cursor Cursor);
+AK_JSON_DEF ak_json_str        AK_Json_Cursor_Get_String(ak_json_cursor Cursor);
+AK_JSON_DEF int                AK_Json_Cursor_Get_Boolean(ak_json_cursor Cursor);
+AK_JSON_DEF double             AK_Json_Cursor_Get_Number(ak_json_cursor Cursor);
+AK_JSON_DEF int                AK_Json_Cursor_Is_Integer(ak_json_cursor Cursor);
+AK_JSON_DEF ak_json_s64        AK_Json_Cursor_Get_Int64(ak_json_cursor Cursor);
+AK_JSON_DEF ak_json_u64        AK_Json_Cursor_Get_Uint64(ak_json_cursor Cursor);
+AK_JSON_DEF unsigned int       AK_Json_Cursor_Get_Length(ak_json_cursor Cursor);
+AK_JSON_DEF ak_json_cursor     AK_Json_Cursor_Get_First(ak_json_cursor Cursor);
+AK_JSON_DEF ak_json_cursor     AK_Json_Cursor_Get_Next(ak_json_cursor Cursor);
+AK_JSON_DEF ak_json_cursor     AK_Json_Cursor_Get_Value(ak_json_cursor Array, unsigned int Index);
+AK_JSON_DEF ak_json_cursor     AK_Json_Cursor_Get_Key(ak_json_cursor Object, ak_json_str Key);
+
+AK_JSON_DEF ak_json_lazy AK_Json_Parse_Lazy(ak_json_context* Context, ak_json_str Str);
+
+AK_JSON_DEF int                AK_Json_Lazy_Is_Valid(ak_json_lazy Lazy);
+AK_JSON_DEF ak_json_value_type AK_Json_Lazy_Get_Type(ak_json_lazy Lazy);
+AK_JSON_DEF ak_json_str        AK_Json_Lazy_Get_String(ak_json_lazy Lazy);
+AK_JSON_DEF int                AK_Json_Lazy_Get_Boolean(ak_json_lazy Lazy);
+AK_JSON_DEF double             AK_Json_Lazy_Get_Number(ak_json_lazy Lazy);
+AK_JSON_DEF int                AK_Json_Lazy_Is_Integer(ak_json_lazy Lazy);
+AK_JSON_DEF ak_json_s64        AK_Json_Lazy_Get_Int64(ak_json_lazy Lazy);
+AK_JSON_DEF ak_json_u64        AK_Json_Lazy_Get_Uint64(ak_json_lazy Lazy);
+AK_JSON_DEF ak_json_lazy       AK_Json_Lazy_Get_First(ak_json_lazy Lazy);
+AK_JSON_DEF ak_json_lazy       AK_Json_Lazy_Get_Next(ak_json_lazy Lazy);
+AK_JSON_DEF ak_json_lazy       AK_Json_Lazy_Get_Value(ak_json_lazy Array, unsigned int Index);
+AK_JSON_DEF ak_json_lazy       AK_Json_Lazy_Get_Key(ak_json_lazy Object, ak_json_str Key);
+
+AK_JSON_DEF ak_json_pointer* AK_Json_Pointer_Compile(ak_json_context* Context, ak_json_str Pointer);
+AK_JSON_DEF ak_json_value*   AK_Json_Pointer_Get(ak_json_value* Value, ak_json_pointer* Pointer);
+
+//NOTE(EVERYONE): AK_Json_Hash_Str is 64 bit FNV-1a. AK_JSON_HASH_LITERAL computes the same hash for a string 
+//literal at compile time, so lookups of constant keys skip hashing entirely:
+//  AK_Json_Object_Get_Key_Literal(Object, "timestamp")
+//C has no constexpr, so the C version unrolls over the literal and is limited to 64 characters, which is 
+//checked at compile time. Compilers fold it to a constant when optimizing, but indexing a string literal is 
+//not an integer constant expression in C, so it can't be used for case labels or static initializers. 
+//C++ uses the constexpr AK_Json_Hash_Literal instead, which has no length limit and works in both
+#define AK_JSON_HASH_OFFSET_BASIS 0xCBF29CE484222325ull
+#define AK_JSON_HASH_PRIME        0x100000001B3ull
+
+#ifdef __cplusplus
+constexpr ak_json_u64 AK_Json_Hash_Literal(const char* Str, ak_json_u64 Length, ak_json_u64 Hash = AK_JSON_HASH_OFFSET_BASIS)
+{
+    return Length ? AK_Json_Hash_Literal(Str+1, Length-1, (Hash ^ (ak_json_u8)*Str) * AK_JSON_HASH_PRIME) : Hash;
+}
+
+template <ak_json_u64 Size>
+constexpr ak_json_u64 AK_Json_Hash_Literal(const char (&Str)[Size])
+{
+    return AK_Json_Hash_Literal(Str, Size-1);
+}
+
+#define AK_JSON_HASH_LITERAL(str) AK_Json_Hash_Literal(str)
+#else
+#define AK_JSON__HASH_LITERAL_MAX_LENGTH 64
+
+//NOTE(EVERYONE): Characters past the end of the literal xor with 0 and multiply by 1, so they leave the hash 
+//alone. The hash only appears once per step, which keeps the expansion linear in the number of steps
+#define AK_JSON__HASH_STEP(h, s, i) \
+    (((h) ^ ((i) < sizeof(s)-1 ? (ak_json_u64)(ak_json_u8)(s)[(i) < sizeof(s) ? (i) : 0] : 0ull)) * ((i) < sizeof(s)-1 ? AK_JSON_HASH_PRIME : 1ull))
+#define AK_JSON__HASH_STEP_8(h, s, i) \
+    AK_JSON__HASH_STEP(AK_JSON__HASH_STEP(AK_JSON__HASH_STEP(AK_JSON__HASH_STEP(AK_JSON__HASH_STEP(AK_JSON__HASH_STEP(AK_JSON__HASH_STEP(AK_JSON__HASH_STEP( \
+    h, s, i), s, i+1), s, i+2), s, i+3), s, i+4), s, i+5), s, i+6), s, i+7)
+#define AK_JSON__HASH_STEP_64(h, s) \
+    AK_JSON__HASH_STEP_8(AK_JSON__HASH_STEP_8(AK_JSON__HASH_STEP_8(AK_JSON__HASH_STEP_8(AK_JSON__HASH_STEP_8(AK_JSON__HASH_STEP_8(AK_JSON__HASH_STEP_8(AK_JSON__HASH_STEP_8( \
+    h, s, 0), s, 8), s, 16), s, 24), s, 32), s, 40), s, 48), s, 56)
+
+#define AK_JSON_HASH_LITERAL(str) \
+    (0*sizeof(char[sizeof(str) <= AK_JSON__HASH_LITERAL_MAX_LENGTH+1 ? 1 : -1]) + AK_JSON__HASH_STEP_64(AK_JSON_HASH_OFFSET_BASIS, str))
+#endif
+
+#define AK_Json_Object_Get_Key_Literal(object, str) AK_Json_Object_Get_Key_Hashed(object, AK_Json_Str(str), AK_JSON_HASH_LITERAL(str))
 
 #endif
 
@@ -95,7 +221,7 @@ AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key(ak_json_object* Object, ak_json_
 #define AK_JSON_ASSERT(cond) assert(cond)
 #endif
 
-#if !defined(AK_JSON_MEMSET) || !defined(AK_JSON_MEMCPY)
+#if !defined(AK_JSON_MEMSET) || !defined(AK_JSON_MEMCPY) || !defined(AK_JSON_MEMCMP)
 #include <string.h>
 #endif
 
@@ -107,7 +233,11 @@ AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key(ak_json_object* Object, ak_json_
 #define AK_JSON_MEMCPY(a,b,c) memcpy(a,b,c)
 #endif
 
-#if !defined(AK_JSON_MALLOC) || !defined(AK_JSON_FREE) || !defined(AK_JSON_ATOF)
+#ifndef AK_JSON_MEMCMP
+#define AK_JSON_MEMCMP(a,b,c) memcmp(a,b,c)
+#endif
+
+#if !defined(AK_JSON_MALLOC) || !defined(AK_JSON_FREE)
 #include <stdlib.h>
 #endif
 
@@ -119,43 +249,69 @@ AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key(ak_json_object* Object, ak_json_
 #define AK_JSON_FREE(memory) free(memory)
 #endif
 
-#if !defined(AK_JSON_ATOF)
-#define AK_JSON_ATOF(str) atof(str)
-#endif
-
 #if !defined(AK_JSON_SNPRINTF)
 #include <stdio.h>
 #define AK_JSON_SNPRINTF(a,b,c,...) snprintf(a,b,c,__VA_ARGS__)
 #endif
 
+#if !defined(AK_JSON_NO_SIMD)
+#if defined(__AVX2__)
+#define AK_JSON__AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AK_JSON__SSE2
+#include <emmintrin.h>
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 /*************
 *** Common ***
 **************/
 
 #define AK_JSON__INTERNAL_ERROR_OUT_OF_MEMORY AK_Json_Str("Out of memory")
 #define AK_JSON__INTERNAL_ERROR_EXPECTED_EOF AK_Json_Str("Expected EOF")
+#define AK_JSON__INTERNAL_ERROR_MAX_DEPTH AK_Json_Str("Arrays and objects are nested deeper than AK_JSON_MAX_DEPTH")
+
+//NOTE(EVERYONE): The parsers recurse once per array or object, so nesting is capped to keep hostile input 
+//from running off the end of the stack
+#ifndef AK_JSON_MAX_DEPTH
+#define AK_JSON_MAX_DEPTH 1024
+#endif
 
 #define STB_SPRINTF_STATIC
 
 static void AK_Json__Set_Error(ak_json_error_code Code, ak_json_str Message);
 
-static unsigned int AK_Json__Max(unsigned int a, unsigned int b)
+static ak_json_u64 AK_Json__Min(ak_json_u64 a, ak_json_u64 b)
 {
-    return a > b ? a : b;
+    return a < b ? a : b;
 }
 
-static void AK_Json__Memory_Clear(void* Memory, unsigned int Size)
+static void AK_Json__Memory_Clear(void* Memory, ak_json_u64 Size)
 {
     AK_JSON_MEMSET(Memory, 0, Size);
 }
 
-static void AK_Json__Memory_Copy(void* Dst, const void* Src, unsigned int Length)
+static void AK_Json__Memory_Copy(void* Dst, const void* Src, ak_json_u64 Length)
 {
     AK_JSON_MEMCPY(Dst, Src, Length);
 }
 
-static void* AK_Json__Default_Allocate(ak_json_allocator* Allocator, unsigned int Size)
+static int AK_Json__Memory_Equal(const void* A, const void* B, ak_json_u64 Length)
+{
+    return AK_JSON_MEMCMP(A, B, Length) == 0;
+}
+
+static void* AK_Json__Default_Allocate(ak_json_allocator* Allocator, ak_json_size Size)
 {
+#ifndef AK_JSON_ALLOCATOR_32
+    //NOTE(EVERYONE): 32 bit targets can't address more than 4 GB anyway
+    if(sizeof(void*) < sizeof(ak_json_u64) && Size > 0xFFFFFFFFull) return NULL;
+#endif
     return AK_JSON_MALLOC(Size);
 }
 
@@ -164,6 +320,16 @@ static void AK_Json__Default_Free(ak_json_allocator* Allocator, void* Memory)
     return AK_JSON_FREE(Memory);
 }
 
+//NOTE(EVERYONE): For arenas over memory that was handed to us, they can never get another block
+static void* AK_Json__Null_Allocate(ak_json_allocator* Allocator, ak_json_size Size)
+{
+    return NULL;
+}
+
+static void AK_Json__Null_Free(ak_json_allocator* Allocator, void* Memory)
+{
+}
+
 static ak_json_allocator AK_Json__Get_Default_Allocator()
 {
     ak_json_allocator Allocator;
@@ -173,9 +339,9 @@ static ak_json_allocator AK_Json__Get_Default_Allocator()
     return Allocator;
 }
 
-static void* AK_Json__Allocate(ak_json_allocator* Allocator, unsigned int Size)
+static void* AK_Json__Allocate(ak_json_allocator* Allocator, ak_json_u64 Size)
 {
-    void* Memory = Allocator->Allocate(Allocator, Size);
+    void* Memory = (ak_json_size)Size == Size ? Allocator->Allocate(Allocator, (ak_json_size)Size) : NULL;
     if(!Memory)
     {
         AK_Json__Set_Error(AK_JSON_ERROR_CODE_OUT_OF_MEMORY, AK_JSON__INTERNAL_ERROR_OUT_OF_MEMORY);
@@ -191,7 +357,7 @@ static void AK_Json__Free(ak_json_allocator* Allocator, void* Memory)
 
 static int AK_Json__Is_Whitespace_Char(ak_json_u8 C)
 {
-    return C == ' ' || C == '\n' || C == '\t' || C == '\f' || C == '\v';
+    return C == ' ' || C == '\n' || C == '\t' || C == '\r';
 }
 
 static int AK_Json__Is_Digit(ak_json_u8 C)
@@ -207,26 +373,18 @@ static int AK_Json__Is_Hex_Digit(ak_json_u8 C)
     return p0 || p1 || p2;
 }
 
-static ak_json_u64 AK_Json__Copy_Whitespace(ak_json_u8* Buffer, ak_json_str Line)
-{
-    ak_json_u64 Index;
-    for(Index = 0; Index < Line.Length; Index++)
-    {
-        if(AK_Json__Is_Whitespace_Char(Line.Str[Index]))
-            Buffer[Index] = Line.Str[Index];
-        else
-            return Index;
-    }
-    //NOTE(EVERYONE): This shouldn't happen
-    AK_JSON_ASSERT(0);
-    return (ak_json_u64)-1;
-}
-
-
 /************
 *** Arena ***
 *************/
 
+//NOTE(EVERYONE): Pushes bump CurrentBlock and only ever move forward to the block after it, every 
+//block past CurrentBlock is unused. When the chain runs out a new block is added that is twice the size of 
+//the last one, up to AK_JSON_ARENA_MAX_BLOCK_SIZE. Allocations bigger than half a block skip the chain and 
+//get a block of their own in the Dedicated list, so they don't throw away the tail of the current block
+#ifndef AK_JSON_ARENA_MAX_BLOCK_SIZE
+#define AK_JSON_ARENA_MAX_BLOCK_SIZE (64*1024*1024)
+#endif
+
 typedef struct ak_json__arena_block
 {
     ak_json_u8* Memory;
@@ -239,9 +397,9 @@ typedef struct ak_json__arena
 {
     ak_json_allocator     Allocator;
     ak_json__arena_block* FirstBlock;
-    ak_json__arena_block* LastBlock;
     ak_json__arena_block* CurrentBlock;
-    unsigned int          InitialBlockSize;
+    ak_json__arena_block* DedicatedBlocks;
+    ak_json_u64           NextBlockSize;
 } ak_json__arena;
 
 typedef struct ak_json__arena_reserve
@@ -252,15 +410,16 @@ typedef struct ak_json__arena_reserve
     ak_json_u64     Size;
 } ak_json__arena_reserve;
 
-static ak_json__arena* AK_Json__Arena_Create(ak_json_allocator Allocator, unsigned int InitialBlockSize)
+static ak_json__arena* AK_Json__Arena_Create(ak_json_allocator Allocator, ak_json_u64 InitialBlockSize)
 {
-    unsigned int AllocationSize = InitialBlockSize+sizeof(ak_json__arena)+sizeof(ak_json__arena_block);
+    ak_json_u64 AllocationSize = InitialBlockSize+sizeof(ak_json__arena)+sizeof(ak_json__arena_block);
     ak_json__arena* Arena = (ak_json__arena*)AK_Json__Allocate(&Allocator, AllocationSize);
     if(!Arena)  return NULL;
     
     Arena->Allocator = Allocator;
-    Arena->InitialBlockSize = InitialBlockSize;
-    Arena->FirstBlock = Arena->LastBlock = Arena->CurrentBlock = (ak_json__arena_block*)(Arena+1);
+    Arena->NextBlockSize = InitialBlockSize;
+    Arena->DedicatedBlocks = NULL;
+    Arena->FirstBlock = Arena->CurrentBlock = (ak_json__arena_block*)(Arena+1);
     Arena->CurrentBlock->Memory = (ak_json_u8*)(Arena->CurrentBlock+1);
     Arena->CurrentBlock->Used = 0;
     Arena->CurrentBlock->Size = InitialBlockSize;
@@ -269,24 +428,71 @@ static ak_json__arena* AK_Json__Arena_Create(ak_json_allocator Allocator, unsign
     return Arena;
 }
 
+static void AK_Json__Arena_Free_Blocks(ak_json__arena* Arena, ak_json__arena_block* Block)
+{
+    while(Block)
+    {
+        ak_json__arena_block* CurrentBlock = Block;
+        Block = Block->Next;
+        AK_Json__Free(&Arena->Allocator, CurrentBlock);
+    }
+}
+
 static void AK_Json__Arena_Delete(ak_json__arena* Arena)
 {
     if(Arena && Arena->FirstBlock)
     {
         ak_json_allocator Allocator = Arena->Allocator;
+        AK_Json__Arena_Free_Blocks(Arena, Arena->FirstBlock->Next);
+        AK_Json__Arena_Free_Blocks(Arena, Arena->DedicatedBlocks);
+        AK_Json__Free(&Allocator, Arena);
+    }
+}
+
+//NOTE(EVERYONE): Rewinds every block so its memory gets reused. Blocks past the first one are freed once the 
+//blocks kept so far add up to more than MaxSize, a MaxSize of 0 keeps all of them
+static void AK_Json__Arena_Reset(ak_json__arena* Arena, ak_json_u64 MaxSize)
+{
+    ak_json__arena_block* Block = Arena->FirstBlock;
+    ak_json_u64 Size = Block->Size;
+    Block->Used = 0;
+    
+    while(Block->Next)
+    {
+        ak_json__arena_block* Next = Block->Next;
+        if(MaxSize && Size+Next->Size > MaxSize)
+        {
+            Block->Next = NULL;
+            AK_Json__Arena_Free_Blocks(Arena, Next);
+            break;
+        }
         
-        ak_json__arena_block* Block;
-        for(Block = Arena->FirstBlock->Next; Block;)
+        Next->Used = 0;
+        Size += Next->Size;
+        Block = Next;
+    }
+    
+    Arena->CurrentBlock = Arena->FirstBlock;
+    
+    ak_json__arena_block** Dedicated = &Arena->DedicatedBlocks;
+    while(*Dedicated)
+    {
+        Block = *Dedicated;
+        if(MaxSize && Size+Block->Size > MaxSize)
         {
-            ak_json__arena_block* CurrentBlock = Block;
-            Block = Block->Next;
-            AK_Json__Free(&Allocator, CurrentBlock);
+            *Dedicated = Block->Next;
+            AK_Json__Free(&Arena->Allocator, Block);
+        }
+        else
+        {
+            Block->Used = 0;
+            Size += Block->Size;
+            Dedicated = &Block->Next;
         }
-        AK_Json__Free(&Allocator, Arena);
     }
 }
 
-static ak_json__arena_block* AK_Json__Arena_Create_Block(ak_json__arena* Arena, unsigned int BlockSize)
+static ak_json__arena_block* AK_Json__Arena_Create_Block(ak_json__arena* Arena, ak_json_u64 BlockSize)
 {
     ak_json_allocator Allocator = Arena->Allocator;
     ak_json__arena_block* Block = (ak_json__arena_block*)AK_Json__Allocate(&Allocator, BlockSize+sizeof(ak_json__arena_block));
@@ -299,101 +505,142 @@ static ak_json__arena_block* AK_Json__Arena_Create_Block(ak_json__arena* Arena,
     return Block;
 }
 
-static ak_json__arena_block* AK_Json__Arena_Get_Block(ak_json__arena* Arena, unsigned int Size)
+//NOTE(EVERYONE): New blocks go right after CurrentBlock so the unused blocks kept from a reset still 
+//come after it
+static void AK_Json__Arena_Insert_Block(ak_json__arena* Arena, ak_json__arena_block* Block)
 {
-    ak_json__arena_block* Block = Arena->CurrentBlock;
-    if(!Block) return NULL;
-    
-    while(Block->Used+Size > Block->Size)
+    ak_json__arena_block* Current = Arena->CurrentBlock;
+    Block->Next = Current->Next;
+    Current->Next = Block;
+}
+
+//NOTE(EVERYONE): Dedicated blocks are only handed out whole. After a reset an unused one that is big enough 
+//is reused, the list only holds allocations bigger than half a block so it stays short
+static ak_json__arena_block* AK_Json__Arena_Get_Dedicated_Block(ak_json__arena* Arena, ak_json_u64 Size)
+{
+    ak_json__arena_block* Block;
+    for(Block = Arena->DedicatedBlocks; Block; Block = Block->Next)
     {
-        Block = Block->Next;
-        if(!Block) return NULL;
+        if(!Block->Used && Block->Size >= Size) return Block;
     }
     
+    Block = AK_Json__Arena_Create_Block(Arena, Size);
+    if(!Block) return NULL;
+    Block->Next = Arena->DedicatedBlocks;
+    Arena->DedicatedBlocks = Block;
     return Block;
 }
 
-static void AK_Json__Arena_Add_Block(ak_json__arena* Arena, ak_json__arena_block* Block)
+static ak_json__arena_block* AK_Json__Arena_Get_Block(ak_json__arena* Arena, ak_json_u64 Size)
 {
-    ak_json__arena_block* Last = Arena->LastBlock;
-    if(!Last)
-    {
-        AK_JSON_ASSERT(!Arena->FirstBlock);
-        Arena->FirstBlock = Arena->LastBlock = Block;
-    }
-    else
+    ak_json__arena_block* Block = Arena->CurrentBlock;
+    if(Block->Used+Size <= Block->Size) return Block;
+    
+    if(Size > Arena->NextBlockSize/2) 
+        return AK_Json__Arena_Get_Dedicated_Block(Arena, Size);
+    
+    Block = Block->Next;
+    if(!Block || Block->Size < Size)
     {
-        Last->Next = Block;
-        Arena->LastBlock = Block;
+        Block = AK_Json__Arena_Create_Block(Arena, Arena->NextBlockSize);
+        if(!Block) return NULL;
+        AK_Json__Arena_Insert_Block(Arena, Block);
+        
+        if(Arena->NextBlockSize < AK_JSON_ARENA_MAX_BLOCK_SIZE)
+            Arena->NextBlockSize = AK_Json__Min(Arena->NextBlockSize*2, AK_JSON_ARENA_MAX_BLOCK_SIZE);
     }
+    
+    Arena->CurrentBlock = Block;
+    return Block;
 }
 
-static void* AK_Json__Arena_Push(ak_json__arena* Arena, unsigned int Size)
+//NOTE(EVERYONE): Every allocation is rounded up so the next one starts 8 byte aligned
+#define AK_JSON__ARENA_ALIGNMENT 8
+#define AK_Json__Arena_Align(size) (((size)+(AK_JSON__ARENA_ALIGNMENT-1)) & ~(AK_JSON__ARENA_ALIGNMENT-1))
+
+static void* AK_Json__Arena_Push(ak_json__arena* Arena, ak_json_u64 Size)
 {
     if(!Size) return NULL;
+    Size = AK_Json__Arena_Align(Size);
     
     ak_json__arena_block* Block = AK_Json__Arena_Get_Block(Arena, Size);
-    if(!Block)
-    {
-        unsigned int BlockSize = AK_Json__Max(Arena->InitialBlockSize, Size);
-        Block = AK_Json__Arena_Create_Block(Arena, BlockSize);
-        if(!Block) return NULL;
-        AK_Json__Arena_Add_Block(Arena, Block);
-    }
-    
-    Arena->CurrentBlock = Block;
-    AK_JSON_ASSERT(Arena->CurrentBlock->Used+Size <= Arena->CurrentBlock->Size);
+    if(!Block) return NULL;
+    AK_JSON_ASSERT(Block->Used+Size <= Block->Size);
     
-    void* Result = Arena->CurrentBlock->Memory + Arena->CurrentBlock->Used;
-    Arena->CurrentBlock->Used += Size;
+    void* Result = Block->Memory + Block->Used;
+    Block->Used += Size;
     
     return Result;
 }
 
-static ak_json__arena_reserve AK_Json__Arena_Begin_Reserve(ak_json__arena* Arena, unsigned int Size)
+static ak_json__arena_reserve AK_Json__Arena_Begin_Reserve(ak_json__arena* Arena, ak_json_u64 Size)
 {
     ak_json__arena_reserve Reserve;
     Reserve.Size = 0;
     Reserve.Arena  = NULL;
     if(!Size) return Reserve;
+    Size = AK_Json__Arena_Align(Size);
     
     ak_json__arena_block* Block = AK_Json__Arena_Get_Block(Arena, Size);
-    if(!Block)
-    {
-        unsigned int BlockSize = AK_Json__Max(Arena->InitialBlockSize, Size);
-        Block = AK_Json__Arena_Create_Block(Arena, BlockSize);
-        if(!Block) return Reserve;
-        AK_Json__Arena_Add_Block(Arena, Block);
-    }
-    
-    Arena->CurrentBlock = Block;
-    AK_JSON_ASSERT(Arena->CurrentBlock->Used+Size <= Arena->CurrentBlock->Size);
+    if(!Block) return Reserve;
+    AK_JSON_ASSERT(Block->Used+Size <= Block->Size);
     
     Reserve.Size = Size;
     Reserve.Arena  = Arena;
-    Reserve.Block = Arena->CurrentBlock;
+    Reserve.Block = Block;
     Reserve.Used  = 0;
     
     return Reserve;
 }
 
-static void* AK_Json__Arena_Push_Reserve(ak_json__arena_reserve* Reserve, unsigned int Size)
+static void AK_Json__Arena_End_Reserve(ak_json__arena_reserve* Reserve)
+{
+    Reserve->Block->Used += AK_Json__Arena_Align(Reserve->Used);
+}
+
+static ak_json_u8* AK_Json__Arena_Reserve_Get_Memory(ak_json__arena_reserve* Reserve)
 {
-    AK_JSON_ASSERT(Reserve->Block->Used+Reserve->Used+Size <= Reserve->Block->Size);
-    void* Result = Reserve->Block->Memory + Reserve->Block->Used + Reserve->Used;
-    Reserve->Used += Size;
+    ak_json_u8* Result = Reserve->Block->Memory + Reserve->Block->Used;
     return Result;
 }
 
-static void AK_Json__Arena_End_Reserve(ak_json__arena* Arena, ak_json__arena_reserve* Reserve)
+//NOTE(EVERYONE): Lays an arena out over Memory with a single block for the rest of it. The arena uses the 
+//null allocator, so once that block is full every push fails with out of memory
+static ak_json__arena* AK_Json__Arena_Create_From_Memory(void* Memory, ak_json_u64 Size)
 {
-    Reserve->Block->Used += Reserve->Used;
+    ak_json_u64 Padding = AK_Json__Arena_Align((ak_json_u64)Memory)-(ak_json_u64)Memory;
+    ak_json_u64 HeaderSize = Padding+sizeof(ak_json__arena)+sizeof(ak_json__arena_block);
+    if(!Memory || Size < HeaderSize) return NULL;
+    
+    ak_json__arena* Arena = (ak_json__arena*)((ak_json_u8*)Memory+Padding);
+    Arena->Allocator.Allocate = AK_Json__Null_Allocate;
+    Arena->Allocator.Free = AK_Json__Null_Free;
+    Arena->Allocator.UserData = 0;
+    Arena->NextBlockSize = Size-HeaderSize;
+    Arena->DedicatedBlocks = NULL;
+    Arena->FirstBlock = Arena->CurrentBlock = (ak_json__arena_block*)(Arena+1);
+    Arena->CurrentBlock->Memory = (ak_json_u8*)(Arena->CurrentBlock+1);
+    Arena->CurrentBlock->Used = 0;
+    Arena->CurrentBlock->Size = Size-HeaderSize;
+    Arena->CurrentBlock->Next = NULL;
+    
+    return Arena;
 }
 
-static ak_json_u8* AK_Json__Arena_Reserve_Get_Memory(ak_json__arena_reserve* Reserve)
+//NOTE(EVERYONE): An allocator that pushes onto the arena in its UserData. Frees do nothing, so a buffer 
+//that grows leaves its old copies behind until the arena is reset
+static void* AK_Json__Arena_Allocate(ak_json_allocator* Allocator, ak_json_size Size)
 {
-    ak_json_u8* Result = Reserve->Block->Memory + Reserve->Block->Used;
-    return Result;
+    return AK_Json__Arena_Push((ak_json__arena*)Allocator->UserData, Size);
+}
+
+static ak_json_allocator AK_Json__Get_Arena_Allocator(ak_json__arena* Arena)
+{
+    ak_json_allocator Allocator;
+    Allocator.Allocate = AK_Json__Arena_Allocate;
+    Allocator.Free = AK_Json__Null_Free;
+    Allocator.UserData = (ak_json_user_data)Arena;
+    return Allocator;
 }
 
 /**************
@@ -424,9 +671,12 @@ static ak_json_str AK_Json_Str__Copy(ak_json__arena* Arena, ak_json_str Str)
     }
     
     ak_json_str Result;
-    Result.Length = Str.Length;
+    Result.Length = 0;
+    Result.Str = NULL;
     char* Buffer = (char*)AK_Json__Arena_Push(Arena, Str.Length+1);
+    if(!Buffer) return Result;
     
+    Result.Length = Str.Length;
     Buffer[Str.Length] = 0;
     AK_Json__Memory_Copy(Buffer, Str.Str, Str.Length);
     
@@ -449,254 +699,150 @@ static ak_json_str AK_Json_Str__Substr(ak_json_str Str, ak_json_u64 StartIndex,
 static int AK_Json_Str__Equal(ak_json_str StrA, ak_json_str StrB)
 {
     if(StrA.Length != StrB.Length) return 0;
-    
-    ak_json_u64 i;
-    for(i = 0; i < StrA.Length; i++)
-    {
-        if(StrA.Str[i] != StrB.Str[i]) 
-            return 0;
-    }
-    return 1;
+    return AK_Json__Memory_Equal(StrA.Str, StrB.Str, StrA.Length);
 }
 
-unsigned int AK_Json__Get_UTF8_Bytecount(unsigned int Codepoint)
+//NOTE(EVERYONE): The hash used for object keys. Callers that look up the same key in many objects can hash 
+//it once and use AK_Json_Object_Get_Key_Hashed
+AK_JSON_DEF ak_json_u64 AK_Json_Hash_Str(ak_json_str Str)
 {
-    unsigned int Result = 0;
-    if (Codepoint <= 0x7F)
-    {
-        Result = 1;
-    }
-    else if (Codepoint <= 0x7FF)
-    {
-        Result = 2;
-    }
-    else if (Codepoint <= 0xFFFF)
-    {
-        Result = 3;
-    }
-    else if (Codepoint <= 0x10FFFF)
-    {
-        Result = 4;
-    }
-    else
+    ak_json_u64 Hash = AK_JSON_HASH_OFFSET_BASIS;
+    ak_json_u64 Index;
+    for(Index = 0; Index < Str.Length; Index++)
     {
-        AK_JSON_ASSERT(0);
+        Hash ^= Str.Str[Index];
+        Hash *= AK_JSON_HASH_PRIME;
     }
-    return Result;
+    return Hash;
 }
 
-void AK_Json__UTF8_From_Codepoint(unsigned int Codepoint, ak_json_u8* Buffer)
+/****************
+*** Key Table ***
+*****************/
+
+//NOTE(EVERYONE): Object keys are interned into the arena the values go to, so keys from AK_Json_Parse are 
+//shared by the whole context and keys of a document by that document only. Identical key bytes are stored 
+//once behind a header that keeps their hash, so objects with the same fields share their key strings and 
+//two keys from the same table are equal exactly when their pointers are. The table itself is open addressing 
+//over pointers to the headers and is kept at most half full
+typedef struct ak_json__interned_key
 {
-    unsigned int Offset = 0;
-    if (Codepoint <= 0x7F)
-    {
-        Buffer[0] = (ak_json_u8)Codepoint;
-        Offset = 1;
-    }
-    else if (Codepoint <= 0x7FF)
-    {
-        Buffer[0] = (AK_JSON__BITMASK_2 << 6) | ((Codepoint >> 6) & AK_JSON__BITMASK_5);
-        Buffer[1] = AK_JSON__BIT_8 | (Codepoint & AK_JSON__BITMASK_6);
-        Offset = 2;
-    }
-    else if (Codepoint <= 0xFFFF)
-    {
-        Buffer[0] = (AK_JSON__BITMASK_3 << 5) | ((Codepoint >> 12) & AK_JSON__BITMASK_4);
-        Buffer[1] = AK_JSON__BIT_8 | ((Codepoint >> 6) & AK_JSON__BITMASK_6);
-        Buffer[2] = AK_JSON__BIT_8 | ( Codepoint       & AK_JSON__BITMASK_6);
-        Offset = 3;
-    }
-    else if (Codepoint <= 0x10FFFF)
-    {
-        Buffer[0] = (AK_JSON__BITMASK_4 << 3) | ((Codepoint >> 18) & AK_JSON__BITMASK_3);
-        Buffer[1] = AK_JSON__BIT_8 | ((Codepoint >> 12) & AK_JSON__BITMASK_6);
-        Buffer[2] = AK_JSON__BIT_8 | ((Codepoint >>  6) & AK_JSON__BITMASK_6);
-        Buffer[3] = AK_JSON__BIT_8 | ( Codepoint        & AK_JSON__BITMASK_6);
-        Offset = 4;
-    }
-    else
-    {
-        //TODO(JJ): We probably do need to handle this case
-        AK_JSON_ASSERT(0);
-    }
-}
+    ak_json_u64 Hash;
+    ak_json_u64 Length;
+} ak_json__interned_key;
 
+typedef struct ak_json__key_table
+{
+    ak_json_allocator       Allocator;
+    ak_json__arena*         Arena;
+    ak_json__interned_key** Slots;
+    ak_json_u64             Count;
+    ak_json_u64             SlotCount;
+} ak_json__key_table;
+
+static ak_json__interned_key* AK_Json__Interned_Key_Get(const ak_json_u8* Str)
+{
+    return ((ak_json__interned_key*)Str)-1;
+}
 
-unsigned int AK_Json__UTF16_To_UTF32(unsigned int Value)
+static ak_json_str AK_Json__Interned_Key_Get_Str(ak_json__interned_key* Key)
 {
-    unsigned int FirstHalf = Value & 0xFFFF;
-    unsigned int SecondHalf = (Value >> 16) & 0xFFFF;
-    unsigned int Result = FirstHalf;
-    if (0xD800 <= FirstHalf && FirstHalf < 0xDC00 && 0xDC00 <= SecondHalf && SecondHalf < 0xE000){
-        Result = ((FirstHalf - 0xD800) << 10) | (SecondHalf - 0xDC00);
-    }
+    ak_json_str Result;
+    Result.Str    = (const ak_json_u8*)(Key+1);
+    Result.Length = Key->Length;
     return Result;
 }
 
-ak_json_str AK_Json__Json_Str_To_UTF8(ak_json__arena* Arena, ak_json_str JsonStr)
+static void AK_Json__Key_Table_Delete(ak_json__key_table* Table)
 {
-    if(!JsonStr.Length)
-    {
-        ak_json_str Result;
-        Result.Length = 0;
-        Result.Str = NULL;
-        return Result;
-    }
-    
-    ak_json__arena_reserve Reserve = AK_Json__Arena_Begin_Reserve(Arena, JsonStr.Length+1);
+    AK_Json__Free(&Table->Allocator, Table->Slots);
+    Table->Slots = NULL;
+    Table->Count = Table->SlotCount = 0;
+}
+
+//NOTE(EVERYONE): Forgets every key but keeps the slots. The keys themselves belong to the arena
+static void AK_Json__Key_Table_Clear(ak_json__key_table* Table)
+{
+    if(Table->Count) AK_Json__Memory_Clear(Table->Slots, Table->SlotCount*sizeof(ak_json__interned_key*));
+    Table->Count = 0;
+}
+
+static int AK_Json__Key_Table_Resize(ak_json__key_table* Table, ak_json_u64 SlotCount)
+{
+    ak_json__interned_key** Slots = (ak_json__interned_key**)AK_Json__Allocate(&Table->Allocator, SlotCount*sizeof(ak_json__interned_key*));
+    if(!Slots) return 0;
+    AK_Json__Memory_Clear(Slots, SlotCount*sizeof(ak_json__interned_key*));
     
     ak_json_u64 Index;
-    for(Index = 0; Index < JsonStr.Length; Index++)
+    for(Index = 0; Index < Table->SlotCount; Index++)
     {
-        if(JsonStr.Str[Index] == '\\')
-        {
-            switch(JsonStr.Str[Index+1])
-            {
-                case 'u':
-                {
-                    ak_json_u64 UniIndex;
-                    
-                    unsigned int ValueUTF16 = 0;
-                    for(UniIndex = 0; UniIndex < 4; UniIndex++)
-                    {
-                        unsigned int Value;
-                        unsigned int Byte = JsonStr.Str[Index+2+UniIndex];
-                        if(Byte >= '0' && Byte <= '9')
-                        {
-                            Value = Byte - 48;
-                        }
-                        else if(Byte >= 'a' && Byte <= 'f')
-                        {
-                            Value = Byte - 97 + 10;
-                        }
-                        else if(Byte >= 'A' && Byte <= 'F')
-                        {
-                            Value = Byte - 65 + 10;
-                        }
-                        
-                        ValueUTF16 |= (Value << 4*(3-UniIndex));
-                    }
-                    
-                    unsigned int ValueUTF32 = AK_Json__UTF16_To_UTF32(ValueUTF16);
-                    
-                    unsigned int ByteCount = AK_Json__Get_UTF8_Bytecount(ValueUTF32);
-                    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, ByteCount);
-                    AK_Json__UTF8_From_Codepoint(ValueUTF32, Memory);
-                    Index += 5;
-                } break;
-                
-                case '"':
-                {
-                    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-                    *Memory = '"';
-                    Index += 1;
-                } break;
-                
-                case '\\':
-                {
-                    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-                    *Memory = '\\';
-                    Index += 1;
-                } break;
-                
-                case 'b':
-                {
-                    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-                    *Memory = '\b';
-                    Index += 1;
-                } break;
-                
-                case 'f':
-                {
-                    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-                    *Memory = '\f';
-                    Index += 1;
-                } break;
-                
-                case 'n':
-                {
-                    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-                    *Memory = '\n';
-                    Index += 1;
-                } break;
-                
-                case 'r':
-                {
-                    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-                    *Memory = '\r';
-                    Index += 1;
-                } break;
-                
-                case 't':
-                {
-                    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-                    *Memory = '\t';
-                    Index += 1;
-                } break;
-                
-                default:
-                {
-                    //NOTE(EVERYONE): Should never happen
-                    AK_JSON_ASSERT(0);
-                } break;
-            }
-        }
-        else
-        {
-            ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-            *Memory = JsonStr.Str[Index];
-        }
+        ak_json__interned_key* Key = Table->Slots[Index];
+        if(!Key) continue;
+        
+        ak_json_u64 SlotIndex = Key->Hash & (SlotCount-1);
+        while(Slots[SlotIndex]) SlotIndex = (SlotIndex+1) & (SlotCount-1);
+        Slots[SlotIndex] = Key;
     }
     
+    AK_Json__Free(&Table->Allocator, Table->Slots);
+    Table->Slots = Slots;
+    Table->SlotCount = SlotCount;
+    return 1;
+}
+
+//NOTE(EVERYONE): The table grows once it is half full, so this is the smallest slot count that holds Count keys 
+//without growing
+static ak_json_u64 AK_Json__Key_Table_Get_Slot_Count(ak_json_u64 Count)
+{
+    ak_json_u64 SlotCount = 256;
+    while(Count*2 >= SlotCount) SlotCount *= 2;
+    return SlotCount;
+}
+
+static int AK_Json__Key_Table_Reserve(ak_json__key_table* Table, ak_json_u64 Count)
+{
+    ak_json_u64 SlotCount = AK_Json__Key_Table_Get_Slot_Count(Count);
+    return SlotCount <= Table->SlotCount || AK_Json__Key_Table_Resize(Table, SlotCount);
+}
+
+//NOTE(EVERYONE): Returns the one stored copy of Str, or a null string when out of memory
+static ak_json_str AK_Json__Key_Table_Intern(ak_json__key_table* Table, ak_json_str Str)
+{
     ak_json_str Result;
-    Result.Length = Reserve.Used;
+    Result.Str    = NULL;
+    Result.Length = 0;
     
-    ak_json_u8* Memory = AK_Json__Arena_Push_Reserve(&Reserve, 1);
-    *Memory = 0;
+    if(Table->Count*2 >= Table->SlotCount && !AK_Json__Key_Table_Resize(Table, Table->SlotCount ? Table->SlotCount*2 : 256)) return Result;
     
-    Result.Str = (const ak_json_u8*)AK_Json__Arena_Reserve_Get_Memory(&Reserve);
+    ak_json_u64 Hash = AK_Json_Hash_Str(Str);
+    ak_json_u64 SlotIndex = Hash & (Table->SlotCount-1);
+    while(Table->Slots[SlotIndex])
+    {
+        ak_json__interned_key* Key = Table->Slots[SlotIndex];
+        if(Key->Hash == Hash && Key->Length == Str.Length && AK_Json__Memory_Equal(Key+1, Str.Str, Str.Length))
+            return AK_Json__Interned_Key_Get_Str(Key);
+        SlotIndex = (SlotIndex+1) & (Table->SlotCount-1);
+    }
     
-    AK_Json__Arena_End_Reserve(Arena, &Reserve);
+    ak_json__interned_key* Key = (ak_json__interned_key*)AK_Json__Arena_Push(Table->Arena, sizeof(ak_json__interned_key)+Str.Length+1);
+    if(!Key) return Result;
     
-    return Result;
+    Key->Hash   = Hash;
+    Key->Length = Str.Length;
+    ak_json_u8* Buffer = (ak_json_u8*)(Key+1);
+    AK_Json__Memory_Copy(Buffer, Str.Str, Str.Length);
+    Buffer[Str.Length] = 0;
+    
+    Table->Slots[SlotIndex] = Key;
+    Table->Count++;
+    return AK_Json__Interned_Key_Get_Str(Key);
 }
 
-/************************
-*** Creating/Deleting ***
-*************************/
+/*************
+*** Errors ***
+**************/
 
-typedef struct ak_json_context
-{
-    ak_json__arena* Arena;
-    ak_json_key*    FreeKeys;
-    ak_json_value*  FreeValues;
-} ak_json_context;
-
-AK_JSON_DEF ak_json_context* AK_Json_Create(ak_json_allocator* pAllocator)
-{
-    ak_json_allocator Allocator = pAllocator ? *pAllocator : AK_Json__Get_Default_Allocator();
-    ak_json__arena* Arena = AK_Json__Arena_Create(Allocator, 1024*1024);
-    if(!Arena) return NULL;
-    
-    ak_json_context* Result = (ak_json_context*)AK_Json__Arena_Push(Arena, sizeof(ak_json_context));
-    Result->Arena = Arena;
-    return Result;
-}
-
-AK_JSON_DEF void AK_Json_Delete(ak_json_context* Context)
-{
-    if(Context)
-    {
-        ak_json__arena* Arena = Context->Arena;
-        AK_Json__Arena_Delete(Arena);
-    }
-}
-
-/*************
-*** Errors ***
-**************/
-
-typedef struct ak_json__error
+typedef struct ak_json__error
 {
     ak_json_error_code Code;
     ak_json_str        Message;
@@ -704,6 +850,14 @@ typedef struct ak_json__error
 
 static ak_json__error G_AK_Json__Internal_Error;
 
+//NOTE(EVERYONE): Logged errors are formatted here instead of into an arena, so a failed parse leaves no memory 
+//behind. The message stays valid until the next error. It quotes at most two lines and a caret line, and 
+//each of those is cut down to AK_JSON__ERROR_MAX_LINE_LENGTH
+#define AK_JSON__ERROR_MAX_LINE_LENGTH 256
+#define AK_JSON__ERROR_BUFFER_SIZE (4*AK_JSON__ERROR_MAX_LINE_LENGTH+1024)
+
+static char G_AK_Json__Error_Buffer[AK_JSON__ERROR_BUFFER_SIZE];
+
 static void AK_Json__Set_Error(ak_json_error_code Code, ak_json_str Message)
 {
     G_AK_Json__Internal_Error.Code    = Code;
@@ -724,6 +878,12 @@ AK_JSON_DEF ak_json_str AK_Json_Get_Error_Message()
 *** Parsing ***
 ***************/
 
+typedef struct ak_json__char
+{
+    ak_json_u64 Index;
+    ak_json_u8  Char;
+} ak_json__char;
+
 typedef struct ak_json__line
 {
     ak_json_u64 Number;
@@ -731,75 +891,117 @@ typedef struct ak_json__line
     ak_json_u64 EndIndex;
 } ak_json__line;
 
-static ak_json__line AK_Json__Line_Null()
+static ak_json_str AK_Json__Line_Get_Str(ak_json_str Str, ak_json__line Line)
 {
-    ak_json__line Line;
-    Line.Number = 0;
-    Line.StartIndex = (ak_json_u64)-1;
-    Line.EndIndex = (ak_json_u64)-1;
-    return Line;
+    ak_json_str Result;
+    Result.Str = Str.Str+Line.StartIndex;
+    Result.Length = Line.EndIndex-Line.StartIndex;
+    return Result;
 }
 
-static ak_json_str AK_Json__Line_Get_Str(ak_json_str Str, ak_json__line Line)
+static ak_json_u64 AK_Json__Line_Break_Length(ak_json_str Str, ak_json_u64 Index)
 {
-    return AK_Json_Str__Substr(Str, Line.StartIndex, Line.EndIndex);
+    if(Str.Str[Index] == '\n') return 1;
+    if(Str.Str[Index] == '\r') return (Index+1 < Str.Length && Str.Str[Index+1] == '\n') ? 2 : 1;
+    return 0;
 }
 
-typedef struct ak_json__char
+//NOTE(EVERYONE): The stream only tracks a byte offset. Line numbers are only needed when an error is 
+//logged, so they are rebuilt here by rescanning the input up to the error location
+static void AK_Json__Find_Lines(ak_json_str Str, ak_json_u64 Index, ak_json__line* PreviousLine, ak_json__line* CurrentLine)
 {
-    ak_json__line PreviousLine;
-    ak_json__line CurrentLine;
-    ak_json_u64 Index;
-    ak_json_u8  Char;
-} ak_json__char;
+    ak_json__line Previous;
+    Previous.Number = 0;
+    Previous.StartIndex = Previous.EndIndex = 0;
+    
+    ak_json__line Current;
+    Current.Number = 1;
+    Current.StartIndex = 0;
+    
+    ak_json_u64 StrIndex = 0;
+    while(StrIndex < Index)
+    {
+        ak_json_u64 BreakLength = AK_Json__Line_Break_Length(Str, StrIndex);
+        if(BreakLength)
+        {
+            Current.EndIndex = StrIndex;
+            Previous = Current;
+            
+            StrIndex += BreakLength;
+            Current.Number++;
+            Current.StartIndex = StrIndex;
+        }
+        else
+        {
+            StrIndex++;
+        }
+    }
+    
+    Current.EndIndex = Current.StartIndex;
+    while(Current.EndIndex < Str.Length && !AK_Json__Line_Break_Length(Str, Current.EndIndex))
+        Current.EndIndex++;
+    
+    *PreviousLine = Previous;
+    *CurrentLine = Current;
+}
 
-static void AK_Json__Error_Log(ak_json__arena* Arena, ak_json_str Str, ak_json_error_code ErrorCode, ak_json__char Char, ak_json_str Message)
+//NOTE(EVERYONE): Lines longer than AK_JSON__ERROR_MAX_LINE_LENGTH, like a whole minified document, are cut 
+//down to a window around the error so the message stays small
+static void AK_Json__Error_Log(ak_json_str Str, ak_json_error_code ErrorCode, ak_json__char Char, ak_json_str Message)
 {
-    ak_json_u64 LineIndex = Char.CurrentLine.Number;
-    static char TempBuffer[1];
-    unsigned int Length;
-    const char* Format;
+    char* Buffer = G_AK_Json__Error_Buffer;
+    ak_json_u64 Length;
+    ak_json__line PreviousLine;
+    ak_json__line CurrentLine;
     ak_json_str PreviousLineStr;
     ak_json_str CurrentLineStr;
     
-    if(LineIndex > 1)
-    {
-        Format = "Error: %.*s\n%d %.*s\n%d %.*s\n";
-        PreviousLineStr = AK_Json__Line_Get_Str(Str, Char.PreviousLine);
-        CurrentLineStr = AK_Json__Line_Get_Str(Str, Char.CurrentLine);
-        Length = AK_JSON_SNPRINTF(TempBuffer, 1, Format, Message.Length, Message.Str, Char.PreviousLine.Number, 
-                                  PreviousLineStr.Length, PreviousLineStr.Str, Char.CurrentLine.Number, CurrentLineStr.Length, CurrentLineStr.Str);
-    }
-    else
+    AK_Json__Find_Lines(Str, Char.Index, &PreviousLine, &CurrentLine);
+    PreviousLineStr = AK_Json__Line_Get_Str(Str, PreviousLine);
+    CurrentLineStr = AK_Json__Line_Get_Str(Str, CurrentLine);
+    ak_json_u64 Column = Char.Index-CurrentLine.StartIndex;
+    
+    if(PreviousLineStr.Length > AK_JSON__ERROR_MAX_LINE_LENGTH) PreviousLineStr.Length = AK_JSON__ERROR_MAX_LINE_LENGTH;
+    if(CurrentLineStr.Length > AK_JSON__ERROR_MAX_LINE_LENGTH)
     {
-        Format = "Error: %.*s\n%d %.*s\n";
-        CurrentLineStr = AK_Json__Line_Get_Str(Str, Char.CurrentLine);
-        Length = AK_JSON_SNPRINTF(TempBuffer, 1, Format, Message.Length, Message.Str, Char.CurrentLine.Number, 
-                                  CurrentLineStr.Length, CurrentLineStr.Str);
+        ak_json_u64 Start = Column > AK_JSON__ERROR_MAX_LINE_LENGTH/2 ? Column-AK_JSON__ERROR_MAX_LINE_LENGTH/2 : 0;
+        if(Start > CurrentLineStr.Length-AK_JSON__ERROR_MAX_LINE_LENGTH) Start = CurrentLineStr.Length-AK_JSON__ERROR_MAX_LINE_LENGTH;
+        CurrentLineStr.Str += Start;
+        CurrentLineStr.Length = AK_JSON__ERROR_MAX_LINE_LENGTH;
+        Column -= Start;
     }
     
-    //NOTE(EVERYONE): The plus 2 is the offset of line number plus space, and then the final character to add 
-    unsigned int CharacterCount = Length+2+(Char.Index-Char.CurrentLine.StartIndex)+1;
-    char* Buffer = (char*)AK_Json__Arena_Push(Arena, CharacterCount+1);
-    Buffer[CharacterCount] = 0;
-    
-    if(LineIndex > 1)
+    if(PreviousLine.Number)
     {
-        AK_JSON_SNPRINTF(Buffer, CharacterCount, Format, Message.Length, Message.Str, Char.PreviousLine.Number, PreviousLineStr.Length, PreviousLineStr.Str, Char.CurrentLine.Number, CurrentLineStr.Length, CurrentLineStr.Str);
+        Length = AK_JSON_SNPRINTF(Buffer, AK_JSON__ERROR_BUFFER_SIZE, "Error: %.*s\n%llu %.*s\n%llu %.*s\n", (int)Message.Length, Message.Str, PreviousLine.Number, 
+                                  (int)PreviousLineStr.Length, PreviousLineStr.Str, CurrentLine.Number, (int)CurrentLineStr.Length, CurrentLineStr.Str);
     }
     else
     {
-        AK_JSON_SNPRINTF(Buffer, CharacterCount, Format, Message.Length, Message.Str, Char.CurrentLine.Number, 
-                         CurrentLineStr.Length, CurrentLineStr.Str);
+        Length = AK_JSON_SNPRINTF(Buffer, AK_JSON__ERROR_BUFFER_SIZE, "Error: %.*s\n%llu %.*s\n", (int)Message.Length, Message.Str, CurrentLine.Number, 
+                                  (int)CurrentLineStr.Length, CurrentLineStr.Str);
     }
     
+    //NOTE(EVERYONE): The caret line is the line number width, a space, the column, and then the caret
+    char LineNumberBuffer[32];
+    ak_json_u64 LineNumberWidth = AK_JSON_SNPRINTF(LineNumberBuffer, sizeof(LineNumberBuffer), "%llu", CurrentLine.Number);
+    ak_json_u64 CharacterCount = Length+LineNumberWidth+1+Column+1;
+    if(CharacterCount+1 > AK_JSON__ERROR_BUFFER_SIZE)
+    {
+        AK_Json__Set_Error(ErrorCode, Message);
+        return;
+    }
     
     char* FinalLine = Buffer + Length;
-    *FinalLine++ = ' ';
-    *FinalLine++ = ' ';
+    ak_json_u64 Index;
+    for(Index = 0; Index < LineNumberWidth+1; Index++)
+        *FinalLine++ = ' ';
     
-    unsigned int WhitespaceCount = AK_Json__Copy_Whitespace((ak_json_u8*)FinalLine, CurrentLineStr);
-    FinalLine[WhitespaceCount] = '^';
+    //NOTE(EVERYONE): Keep tabs so the caret lines up with the source line
+    for(Index = 0; Index < Column; Index++)
+        *FinalLine++ = CurrentLineStr.Str[Index] == '\t' ? '\t' : ' ';
+    *FinalLine++ = '^';
+    *FinalLine = 0;
     
     ak_json_str Result;
     Result.Str = (const ak_json_u8*)Buffer;
@@ -808,43 +1010,279 @@ static void AK_Json__Error_Log(ak_json__arena* Arena, ak_json_str Str, ak_json_e
     AK_Json__Set_Error(ErrorCode, Result);
 }
 
-typedef struct ak_json__stream
+/****************************
+*** Block Classification ***
+*****************************/
+
+//NOTE(EVERYONE): The input is classified 64 bytes at a time into bitmasks (quotes, backslashes, whitespace 
+//and the structural characters {}[]:,), so the document prepass can tell which bytes are inside of strings 
+//without looking at each of them
+
+#define AK_JSON__BLOCK_SIZE 64
+
+typedef struct ak_json__block_masks
 {
-    ak_json_str   Str;
-    ak_json_u64   StrIndex;
-    ak_json_u64   LineNumber;
-    ak_json__line PreviousLine;
-    ak_json__line CurrentLine;
-} ak_json__stream;
+    ak_json_u64 Quote;
+    ak_json_u64 Backslash;
+    ak_json_u64 Whitespace;
+    ak_json_u64 Operator;
+} ak_json__block_masks;
 
-static void AK_Json__Stream_Consume_Line(ak_json__stream* Stream)
+static unsigned int AK_Json__Count_Trailing_Zeros(ak_json_u64 Value)
 {
-    ak_json_u64 Index = Stream->StrIndex;
-    while(Index < Stream->Str.Length)
+    AK_JSON_ASSERT(Value);
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_ctzll(Value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long Result;
+    _BitScanForward64(&Result, Value);
+    return (unsigned int)Result;
+#else
+    unsigned int Result = 0;
+    while(!(Value & 1))
     {
-        if(Stream->Str.Str[Index] == '\r')
-        {
-            if(!Index || Stream->Str.Str[Index-1] != '\n')
-                break;
-        }
-        else if(Stream->Str.Str[Index] == '\n')
+        Value >>= 1;
+        Result++;
+    }
+    return Result;
+#endif
+}
+
+static ak_json_u64 AK_Json__Prefix_Xor(ak_json_u64 Bits)
+{
+    Bits ^= Bits << 1;
+    Bits ^= Bits << 2;
+    Bits ^= Bits << 4;
+    Bits ^= Bits << 8;
+    Bits ^= Bits << 16;
+    Bits ^= Bits << 32;
+    return Bits;
+}
+
+#if defined(AK_JSON__AVX2)
+static ak_json_u64 AK_Json__Cmp_Mask_32(__m256i Chars, char C)
+{
+    return (ak_json_u64)(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(Chars, _mm256_set1_epi8(C)));
+}
+
+static ak_json__block_masks AK_Json__Classify_Block(const ak_json_u8* Block)
+{
+    ak_json__block_masks Result;
+    AK_Json__Memory_Clear(&Result, sizeof(ak_json__block_masks));
+    
+    unsigned int Index;
+    for(Index = 0; Index < 2; Index++)
+    {
+        __m256i Chars = _mm256_loadu_si256((const __m256i*)(Block + Index*32));
+        unsigned int Shift = Index*32;
+        Result.Quote      |= AK_Json__Cmp_Mask_32(Chars, '"') << Shift;
+        Result.Backslash  |= AK_Json__Cmp_Mask_32(Chars, '\\') << Shift;
+        Result.Whitespace |= (AK_Json__Cmp_Mask_32(Chars, ' ')  | AK_Json__Cmp_Mask_32(Chars, '\t') | 
+                              AK_Json__Cmp_Mask_32(Chars, '\n') | AK_Json__Cmp_Mask_32(Chars, '\r')) << Shift;
+        Result.Operator   |= (AK_Json__Cmp_Mask_32(Chars, '{')  | AK_Json__Cmp_Mask_32(Chars, '}') | 
+                              AK_Json__Cmp_Mask_32(Chars, '[')  | AK_Json__Cmp_Mask_32(Chars, ']') | 
+                              AK_Json__Cmp_Mask_32(Chars, ':')  | AK_Json__Cmp_Mask_32(Chars, ',')) << Shift;
+    }
+    
+    return Result;
+}
+#elif defined(AK_JSON__SSE2)
+static ak_json_u64 AK_Json__Cmp_Mask_16(__m128i Chars, char C)
+{
+    return (ak_json_u64)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(Chars, _mm_set1_epi8(C)));
+}
+
+static ak_json__block_masks AK_Json__Classify_Block(const ak_json_u8* Block)
+{
+    ak_json__block_masks Result;
+    AK_Json__Memory_Clear(&Result, sizeof(ak_json__block_masks));
+    
+    unsigned int Index;
+    for(Index = 0; Index < 4; Index++)
+    {
+        __m128i Chars = _mm_loadu_si128((const __m128i*)(Block + Index*16));
+        unsigned int Shift = Index*16;
+        Result.Quote      |= AK_Json__Cmp_Mask_16(Chars, '"') << Shift;
+        Result.Backslash  |= AK_Json__Cmp_Mask_16(Chars, '\\') << Shift;
+        Result.Whitespace |= (AK_Json__Cmp_Mask_16(Chars, ' ')  | AK_Json__Cmp_Mask_16(Chars, '\t') | 
+                              AK_Json__Cmp_Mask_16(Chars, '\n') | AK_Json__Cmp_Mask_16(Chars, '\r')) << Shift;
+        Result.Operator   |= (AK_Json__Cmp_Mask_16(Chars, '{')  | AK_Json__Cmp_Mask_16(Chars, '}') | 
+                              AK_Json__Cmp_Mask_16(Chars, '[')  | AK_Json__Cmp_Mask_16(Chars, ']') | 
+                              AK_Json__Cmp_Mask_16(Chars, ':')  | AK_Json__Cmp_Mask_16(Chars, ',')) << Shift;
+    }
+    
+    return Result;
+}
+#else
+static ak_json__block_masks AK_Json__Classify_Block(const ak_json_u8* Block)
+{
+    ak_json__block_masks Result;
+    AK_Json__Memory_Clear(&Result, sizeof(ak_json__block_masks));
+    
+    unsigned int Index;
+    for(Index = 0; Index < AK_JSON__BLOCK_SIZE; Index++)
+    {
+        ak_json_u64 Bit = 1ull << Index;
+        switch(Block[Index])
         {
-            if(!Index || Stream->Str.Str[Index-1] != '\r')
-                break;
+            case '"':  Result.Quote |= Bit; break;
+            case '\\': Result.Backslash |= Bit; break;
+            
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r': Result.Whitespace |= Bit; break;
+            
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',': Result.Operator |= Bit; break;
         }
-        
-        Index++;
     }
     
-    ak_json__line Line;
-    Line.StartIndex = Stream->StrIndex;
-    Line.EndIndex = Index;
-    Line.Number = Stream->LineNumber++;
+    return Result;
+}
+#endif
+
+/*****************
+*** Whitespace ***
+******************/
+
+static ak_json_u64 AK_Json__Load_U64(const ak_json_u8* Str)
+{
+    ak_json_u64 Result;
+    AK_Json__Memory_Copy(&Result, Str, sizeof(ak_json_u64));
+    return Result;
+}
+
+#if defined(AK_JSON__AVX2)
+static unsigned int AK_Json__Whitespace_Mask_32(const ak_json_u8* Str)
+{
+    __m256i Chars = _mm256_loadu_si256((const __m256i*)Str);
+    __m256i Mask = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(Chars, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(Chars, _mm256_set1_epi8('\t'))), 
+                                   _mm256_or_si256(_mm256_cmpeq_epi8(Chars, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(Chars, _mm256_set1_epi8('\r'))));
+    return (unsigned int)_mm256_movemask_epi8(Mask);
+}
+#elif defined(AK_JSON__SSE2)
+static unsigned int AK_Json__Whitespace_Mask_16(const ak_json_u8* Str)
+{
+    __m128i Chars = _mm_loadu_si128((const __m128i*)Str);
+    __m128i Mask = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(Chars, _mm_set1_epi8('\t'))), 
+                                _mm_or_si128(_mm_cmpeq_epi8(Chars, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(Chars, _mm_set1_epi8('\r'))));
+    return (unsigned int)_mm_movemask_epi8(Mask);
+}
+#elif !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define AK_JSON__SWAR
+
+//NOTE(EVERYONE): Sets the high bit of every byte in Word that equals C, without false positives
+static ak_json_u64 AK_Json__SWAR_Byte_Equal(ak_json_u64 Word, ak_json_u8 C)
+{
+    ak_json_u64 Low7 = 0x7F7F7F7F7F7F7F7Full;
+    ak_json_u64 X = Word ^ (0x0101010101010101ull*C);
+    return ~(((X & Low7) + Low7) | X | Low7);
+}
+#endif
+
+//NOTE(EVERYONE): Skips whitespace starting at Index. Pretty printed input is mostly a newline followed 
+//by indentation, so runs of 8 spaces or tabs are eaten first, and anything longer is handled 16-32 
+//bytes at a time
+static ak_json_u64 AK_Json__Skip_Whitespace(const ak_json_u8* Str, ak_json_u64 Index, ak_json_u64 Length)
+{
+    while(Index+8 <= Length)
+    {
+        ak_json_u64 Word = AK_Json__Load_U64(Str+Index);
+        if(Word != 0x2020202020202020ull && Word != 0x0909090909090909ull) break;
+        Index += 8;
+    }
+    
+#if defined(AK_JSON__AVX2)
+    while(Index+32 <= Length)
+    {
+        unsigned int Mask = AK_Json__Whitespace_Mask_32(Str+Index);
+        if(Mask != 0xFFFFFFFF) return Index + AK_Json__Count_Trailing_Zeros(~Mask);
+        Index += 32;
+    }
+#elif defined(AK_JSON__SSE2)
+    while(Index+16 <= Length)
+    {
+        unsigned int Mask = AK_Json__Whitespace_Mask_16(Str+Index);
+        if(Mask != 0xFFFF) return Index + AK_Json__Count_Trailing_Zeros(~Mask & 0xFFFF);
+        Index += 16;
+    }
+#elif defined(AK_JSON__SWAR)
+    while(Index+8 <= Length)
+    {
+        ak_json_u64 Word = AK_Json__Load_U64(Str+Index);
+        ak_json_u64 Whitespace = AK_Json__SWAR_Byte_Equal(Word, ' ')  | AK_Json__SWAR_Byte_Equal(Word, '\t') | 
+                                 AK_Json__SWAR_Byte_Equal(Word, '\n') | AK_Json__SWAR_Byte_Equal(Word, '\r');
+        ak_json_u64 NonWhitespace = ~Whitespace & 0x8080808080808080ull;
+        if(NonWhitespace) return Index + AK_Json__Count_Trailing_Zeros(NonWhitespace)/8;
+        Index += 8;
+    }
+#endif
+    
+    while(Index < Length && AK_Json__Is_Whitespace_Char(Str[Index]))
+        Index++;
+    return Index;
+}
+
+//NOTE(EVERYONE): Returns the index of the first quote, backslash or control character at or after Index
+static ak_json_u64 AK_Json__Find_String_Special(const ak_json_u8* Str, ak_json_u64 Index, ak_json_u64 Length)
+{
+#if defined(AK_JSON__AVX2)
+    __m256i Quote     = _mm256_set1_epi8('"');
+    __m256i Backslash = _mm256_set1_epi8('\\');
+    __m256i Control   = _mm256_set1_epi8(0x1F);
+    while(Index+32 <= Length)
+    {
+        __m256i Chars = _mm256_loadu_si256((const __m256i*)(Str+Index));
+        __m256i Mask = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(Chars, Quote), _mm256_cmpeq_epi8(Chars, Backslash)), 
+                                       _mm256_cmpeq_epi8(_mm256_max_epu8(Chars, Control), Control));
+        unsigned int Bits = (unsigned int)_mm256_movemask_epi8(Mask);
+        if(Bits) return Index + AK_Json__Count_Trailing_Zeros(Bits);
+        Index += 32;
+    }
+#elif defined(AK_JSON__SSE2)
+    __m128i Quote     = _mm_set1_epi8('"');
+    __m128i Backslash = _mm_set1_epi8('\\');
+    __m128i Control   = _mm_set1_epi8(0x1F);
+    while(Index+16 <= Length)
+    {
+        __m128i Chars = _mm_loadu_si128((const __m128i*)(Str+Index));
+        __m128i Mask = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Chars, Quote), _mm_cmpeq_epi8(Chars, Backslash)), 
+                                    _mm_cmpeq_epi8(_mm_max_epu8(Chars, Control), Control));
+        unsigned int Bits = (unsigned int)_mm_movemask_epi8(Mask);
+        if(Bits) return Index + AK_Json__Count_Trailing_Zeros(Bits);
+        Index += 16;
+    }
+#elif defined(AK_JSON__SWAR)
+    while(Index+8 <= Length)
+    {
+        ak_json_u64 Word = AK_Json__Load_U64(Str+Index);
+        ak_json_u64 Control = ~(((Word & 0x7F7F7F7F7F7F7F7Full) + 0x6060606060606060ull) | Word) & 0x8080808080808080ull;
+        ak_json_u64 Special = AK_Json__SWAR_Byte_Equal(Word, '"') | AK_Json__SWAR_Byte_Equal(Word, '\\') | Control;
+        if(Special) return Index + AK_Json__Count_Trailing_Zeros(Special)/8;
+        Index += 8;
+    }
+#endif
     
-    Stream->PreviousLine = Stream->CurrentLine;
-    Stream->CurrentLine = Line;
+    while(Index < Length)
+    {
+        ak_json_u8 Char = Str[Index];
+        if(Char == '"' || Char == '\\' || Char < 0x20) return Index;
+        Index++;
+    }
+    return Index;
 }
 
+typedef struct ak_json__stream
+{
+    ak_json_str Str;
+    ak_json_u64 StrIndex;
+} ak_json__stream;
+
 static int AK_Json__Stream_Is_Valid(ak_json__stream* Stream)
 {
     return Stream->StrIndex < Stream->Str.Length;
@@ -859,19 +1297,14 @@ static ak_json_u64 AK_Json__Stream_Get_Remaining(ak_json__stream* Stream)
 static void AK_Json__Stream_Increment(ak_json__stream* Stream)
 {
     AK_JSON_ASSERT(Stream->StrIndex < Stream->Str.Length);
-    AK_JSON_ASSERT(Stream->StrIndex < Stream->CurrentLine.EndIndex);
     Stream->StrIndex++;
-    if(Stream->CurrentLine.EndIndex == Stream->StrIndex) AK_Json__Stream_Consume_Line(Stream);
 }
 
 static ak_json__char AK_Json__Stream_Peek_Char(ak_json__stream* Stream)
 {
     AK_JSON_ASSERT(Stream->StrIndex < Stream->Str.Length);
-    AK_JSON_ASSERT(Stream->StrIndex < Stream->CurrentLine.EndIndex);
     
     ak_json__char Result;
-    Result.PreviousLine = Stream->PreviousLine;
-    Result.CurrentLine = Stream->CurrentLine;
     Result.Index = Stream->StrIndex;
     Result.Char = Stream->Str.Str[Stream->StrIndex];
     return Result;
@@ -886,114 +1319,42 @@ static ak_json__char AK_Json__Stream_Consume_Char(ak_json__stream* Stream)
 
 static void AK_Json__Stream_Eat_Whitespace(ak_json__stream* Stream)
 {
-    ak_json_str* Str = &Stream->Str;
-    while(AK_Json__Stream_Is_Valid(Stream))
-    {
-        ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
-        if(!AK_Json__Is_Whitespace_Char(Char.Char))
-            break;
-        AK_Json__Stream_Increment(Stream);
-    }
+    const ak_json_u8* Str = Stream->Str.Str;
+    ak_json_u64 Length = Stream->Str.Length;
+    ak_json_u64 Index = Stream->StrIndex;
+    
+    //NOTE(EVERYONE): Most tokens are followed by a structural character directly
+    if(Index >= Length || !AK_Json__Is_Whitespace_Char(Str[Index])) return;
+    
+    Stream->StrIndex = AK_Json__Skip_Whitespace(Str, Index+1, Length);
 }
 
 static void AK_Json__Stream_Eat_Digits(ak_json__stream* Stream)
 {
-    ak_json_str* Str = &Stream->Str;
-    while(AK_Json__Stream_Is_Valid(Stream))
-    {
-        ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
-        if(!AK_Json__Is_Digit(Char.Char))
-            break;
-        AK_Json__Stream_Increment(Stream);
-    }
+    const ak_json_u8* Str = Stream->Str.Str;
+    ak_json_u64 Length = Stream->Str.Length;
+    ak_json_u64 Index = Stream->StrIndex;
+    while(Index < Length && AK_Json__Is_Digit(Str[Index]))
+        Index++;
+    Stream->StrIndex = Index;
 }
 
 static ak_json__stream AK_Json__Stream_Create(ak_json_str Str)
 {
     ak_json__stream Stream;
-    Stream.Str           = Str;
-    Stream.LineNumber    = 1;
-    Stream.StrIndex      = 0;
-    Stream.PreviousLine  = AK_Json__Line_Null();
-    Stream.CurrentLine   = AK_Json__Line_Null();
-    AK_Json__Stream_Consume_Line(&Stream);
+    Stream.Str      = Str;
+    Stream.StrIndex = 0;
     return Stream;
 }
 
-typedef enum ak_json__token_type
-{
-    AK_JSON__TOKEN_TYPE_UNDEFINED,
-    AK_JSON__TOKEN_TYPE_NULL,
-    AK_JSON__TOKEN_TYPE_BOOLEAN,
-    AK_JSON__TOKEN_TYPE_NUMBER,
-    AK_JSON__TOKEN_TYPE_STRING,
-    AK_JSON__TOKEN_TYPE_COMMA,
-    AK_JSON__TOKEN_TYPE_ARRAY_START,
-    AK_JSON__TOKEN_TYPE_ARRAY_END,
-    AK_JSON__TOKEN_TYPE_OBJECT_START,
-    AK_JSON__TOKEN_TYPE_OBJECT_END,
-    AK_JSON__TOKEN_TYPE_OBJECT_KEY_DELIMITER,
-    AK_JSON__TOKEN_TYPE_TERMINATOR
-} ak_json__token_type;
-
-typedef struct ak_json__token
-{
-    ak_json__token_type    Type;
-    ak_json__char          StartChar;
-    ak_json_u64            Length;
-    struct ak_json__token* Next;
-} ak_json__token;
-
-static ak_json_str AK_Json__Token_Get_Str(ak_json_str Str, ak_json__token* Token)
-{
-    ak_json_str Result = AK_Json_Str__Substr(Str, Token->StartChar.Index, Token->StartChar.Index+Token->Length);
-    return Result;
-}
-
-typedef struct ak_json__token_list
-{
-    ak_json__token* First;
-    ak_json__token* Last;
-    ak_json_u64     Count;
-} ak_json__token_list;
-
-static void AK_Json__Token_List_Add(ak_json__token_list* List, ak_json__token* Token)
-{
-    if(!List->First) List->First = Token;
-    else List->Last->Next = Token;
-    List->Last = Token;
-    List->Count++;
-}
-
-typedef struct ak_json__tokenizer
-{
-    ak_json__arena*     TokenArena;
-    ak_json__arena*     ErrorArena;
-    ak_json__token_list Tokens;
-} ak_json__tokenizer;
-
-static ak_json__token* AK_Json__Tokenizer_Allocate_Token(ak_json__tokenizer* Tokenizer, ak_json__token_type Type, ak_json__char StartChar)
-{
-    ak_json__token* Token = (ak_json__token*)AK_Json__Arena_Push(Tokenizer->TokenArena, sizeof(ak_json__token));
-    Token->Type = Type;
-    Token->StartChar = StartChar;
-    Token->Length = (ak_json_u64)-1;
-    Token->Next = NULL;
-    
-    AK_Json__Token_List_Add(&Tokenizer->Tokens, Token);
-    return Token;
-}
-
-#define AK_Json__Return_Undefined(Char) \
-do \
-{ \
-ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_UNDEFINED, Char); \
-return 0; \
-} while(0)
+/***************
+*** Scanning ***
+****************/
 
-static int AK_Json__Tokenize_Generic(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream);
+//NOTE(EVERYONE): The scanners validate a single json token and leave the stream right after it. 
+//They are shared by the single pass parser and the two pass tokenizer
 
-static int AK_Json__Tokenize_Null(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+static int AK_Json__Scan_Null(ak_json__stream* Stream)
 {
     ak_json__char Char1 = AK_Json__Stream_Consume_Char(Stream);
     AK_JSON_ASSERT(Char1.Char == 'n');
@@ -1006,17 +1367,13 @@ static int AK_Json__Tokenize_Null(ak_json__tokenizer* Tokenizer, ak_json__stream
         ak_json__char Char4 = AK_Json__Stream_Consume_Char(Stream);
         
         if(Char2.Char == 'u' && Char3.Char == 'l' && Char4.Char == 'l')
-        {
-            ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_NULL, Char1);
-            Token->Length = 4;
             return 1;
-        }
     }
     
-    AK_Json__Return_Undefined(Char1);
+    return 0;
 }
 
-static int AK_Json__Tokenize_Boolean(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+static int AK_Json__Scan_Boolean(ak_json__stream* Stream, int* Boolean)
 {
     ak_json__char Char1 = AK_Json__Stream_Consume_Char(Stream);
     AK_JSON_ASSERT(Char1.Char == 't' || Char1.Char == 'f');
@@ -1033,888 +1390,4281 @@ static int AK_Json__Tokenize_Boolean(ak_json__tokenizer* Tokenizer, ak_json__str
         
         if(Chars[0] == 't' && Chars[1] == 'r' && Chars[2] == 'u' && Chars[3] == 'e')
         {
-            ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_BOOLEAN, Char1);
-            Token->Length = 4;
+            *Boolean = 1;
             return 1;
         }
         else if(Chars[0] == 'f' && Chars[1] == 'a' && Chars[2] == 'l' && Chars[3] == 's' && Chars[4] == 'e')
         {
-            ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_BOOLEAN, Char1);
-            Token->Length = 5;
+            *Boolean = 0;
             return 1;
         }
     }
     
-    AK_Json__Return_Undefined(Char1);
+    return 0;
 }
 
-static int AK_Json__Tokenize_Number(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+static int AK_Json__Scan_Number(ak_json__stream* Stream)
 {
     ak_json__char StartChar = AK_Json__Stream_Consume_Char(Stream);
+    if(!AK_Json__Is_Digit(StartChar.Char) && StartChar.Char != '-')
+        return 0;
+    
+    ak_json__char Char = StartChar;
+    if(Char.Char == '-') 
+    {
+        if(!AK_Json__Stream_Is_Valid(Stream))
+            return 0;
+        Char = AK_Json__Stream_Consume_Char(Stream);
+        if(!AK_Json__Is_Digit(Char.Char))
+            return 0;
+    }
     
-    if(AK_Json__Is_Digit(StartChar.Char) || StartChar.Char == '-')
+    int IsZero = Char.Char == '0';
+    if(!IsZero) AK_Json__Stream_Eat_Digits(Stream);
+    if(AK_Json__Stream_Is_Valid(Stream))
     {
-        ak_json__char Char = StartChar;
-        if(Char.Char == '-') 
+        Char = AK_Json__Stream_Peek_Char(Stream);
+        if(IsZero && AK_Json__Is_Digit(Char.Char))
+            return 0;
+        
+        if(Char.Char == '.') 
         {
+            AK_Json__Stream_Increment(Stream);
             if(!AK_Json__Stream_Is_Valid(Stream))
-            {
-                AK_Json__Return_Undefined(StartChar);
-            }
+                return 0;
             
-            Char = AK_Json__Stream_Consume_Char(Stream);
+            Char = AK_Json__Stream_Peek_Char(Stream);
+            if(!AK_Json__Is_Digit(Char.Char))
+                return 0;
+            AK_Json__Stream_Eat_Digits(Stream);
         }
         
-        int IsZero = Char.Char == '0';
-        if(!IsZero) AK_Json__Stream_Eat_Digits(Stream);
         if(AK_Json__Stream_Is_Valid(Stream))
         {
-            ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
-            if(IsZero && AK_Json__Is_Digit(Char.Char))
-            {
-                AK_Json__Return_Undefined(StartChar);
-            }
-            
-            if(Char.Char == '.') 
+            Char = AK_Json__Stream_Peek_Char(Stream);
+            if(Char.Char == 'e' || Char.Char == 'E')
             {
                 AK_Json__Stream_Increment(Stream);
-                if(AK_Json__Stream_Is_Valid(Stream))
+                if(!AK_Json__Stream_Is_Valid(Stream))
+                    return 0;
+                
+                Char = AK_Json__Stream_Peek_Char(Stream);
+                if(Char.Char == '-' || Char.Char == '+')
                 {
+                    AK_Json__Stream_Increment(Stream);
+                    if(!AK_Json__Stream_Is_Valid(Stream))
+                        return 0;
                     Char = AK_Json__Stream_Peek_Char(Stream);
-                    if(AK_Json__Is_Digit(Char.Char))
-                        AK_Json__Stream_Eat_Digits(Stream);
-                    else
-                    {
-                        AK_Json__Return_Undefined(StartChar);
-                    }
-                }
-                else
-                {
-                    AK_Json__Return_Undefined(StartChar);
                 }
+                
+                if(!AK_Json__Is_Digit(Char.Char))
+                    return 0;
+                AK_Json__Stream_Eat_Digits(Stream);
             }
+        }
+    }
+    
+    return 1;
+}
+
+static int AK_Json__Scan_String(ak_json__stream* Stream, int* HasEscapes)
+{
+    const ak_json_u8* Str = Stream->Str.Str;
+    ak_json_u64 Length = Stream->Str.Length;
+    ak_json_u64 Index = Stream->StrIndex;
+    AK_JSON_ASSERT(Str[Index] == '"');
+    Index++;
+    
+    *HasEscapes = 0;
+    for(;;)
+    {
+        //NOTE(EVERYONE): Plain characters are skipped in bulk. We only stop on the closing quote, an escape, or 
+        //a control character which json does not allow inside of strings
+        Index = AK_Json__Find_String_Special(Str, Index, Length);
+        if(Index >= Length) break;
+        
+        ak_json_u8 Char = Str[Index];
+        if(Char == '"')
+        {
+            Stream->StrIndex = Index+1;
+            return 1;
+        }
+        
+        if(Char != '\\') break;
+        
+        *HasEscapes = 1;
+        Index++;
+        if(Index >= Length) break;
+        
+        switch(Str[Index])
+        {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+            {
+                //NOTE(EVERYONE): Noop. These are the valid control points
+                Index++;
+            } break;
             
-            if(AK_Json__Stream_Is_Valid(Stream))
+            case 'u':
             {
-                Char = AK_Json__Stream_Peek_Char(Stream);
-                if(Char.Char == 'e' || Char.Char == 'E')
+                if(Length-Index < 5)
                 {
-                    AK_Json__Stream_Increment(Stream);
-                    if(!AK_Json__Stream_Is_Valid(Stream))
-                    {
-                        AK_Json__Return_Undefined(StartChar);
-                    }
-                    
-                    Char = AK_Json__Stream_Peek_Char(Stream);
-                    if(Char.Char == '-' || Char.Char == '+')
-                    {
-                        AK_Json__Stream_Increment(Stream);
-                        if(!AK_Json__Stream_Is_Valid(Stream))
-                        {
-                            AK_Json__Return_Undefined(StartChar);
-                        }
-                        
-                        Char = AK_Json__Stream_Peek_Char(Stream);
-                    }
-                    
-                    if(AK_Json__Is_Digit(Char.Char))
-                        AK_Json__Stream_Eat_Digits(Stream);
-                    else
+                    Stream->StrIndex = Length;
+                    return 0;
+                }
+                
+                ak_json_u64 UniIndex;
+                for(UniIndex = 1; UniIndex < 5; UniIndex++)
+                {
+                    if(!AK_Json__Is_Hex_Digit(Str[Index+UniIndex]))
                     {
-                        AK_Json__Return_Undefined(StartChar);
+                        Stream->StrIndex = Index+UniIndex;
+                        return 0;
                     }
                 }
-            }
+                Index += 5;
+            } break;
+            
+            default:
+            {
+                Stream->StrIndex = Index;
+                return 0;
+            } break;
         }
-        
-        ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_NUMBER, StartChar);
-        Token->Length = Stream->StrIndex-StartChar.Index;
+    }
+    
+    Stream->StrIndex = Index < Length ? Index : Length;
+    return 0;
+}
+
+/***************
+*** Decoding ***
+****************/
+
+static unsigned int AK_Json__UTF8_From_Codepoint(unsigned int Codepoint, ak_json_u8* Buffer)
+{
+    if (Codepoint <= 0x7F)
+    {
+        Buffer[0] = (ak_json_u8)Codepoint;
         return 1;
     }
-    else
+    else if (Codepoint <= 0x7FF)
+    {
+        Buffer[0] = (AK_JSON__BITMASK_2 << 6) | ((Codepoint >> 6) & AK_JSON__BITMASK_5);
+        Buffer[1] = AK_JSON__BIT_8 | (Codepoint & AK_JSON__BITMASK_6);
+        return 2;
+    }
+    else if (Codepoint <= 0xFFFF)
     {
-        AK_Json__Return_Undefined(StartChar);
+        Buffer[0] = (AK_JSON__BITMASK_3 << 5) | ((Codepoint >> 12) & AK_JSON__BITMASK_4);
+        Buffer[1] = AK_JSON__BIT_8 | ((Codepoint >> 6) & AK_JSON__BITMASK_6);
+        Buffer[2] = AK_JSON__BIT_8 | ( Codepoint       & AK_JSON__BITMASK_6);
+        return 3;
     }
+    
+    AK_JSON_ASSERT(Codepoint <= 0x10FFFF);
+    Buffer[0] = 0xF0 | ((Codepoint >> 18) & AK_JSON__BITMASK_3);
+    Buffer[1] = AK_JSON__BIT_8 | ((Codepoint >> 12) & AK_JSON__BITMASK_6);
+    Buffer[2] = AK_JSON__BIT_8 | ((Codepoint >>  6) & AK_JSON__BITMASK_6);
+    Buffer[3] = AK_JSON__BIT_8 | ( Codepoint        & AK_JSON__BITMASK_6);
+    return 4;
 }
 
-static int AK_Json__Tokenize_String(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+//NOTE(EVERYONE): Maps the character after a backslash to the byte it decodes to. Zero means the escape 
+//is either a unicode escape or invalid
+static const ak_json_u8 G_AK_Json__Escape_Table[256] = 
 {
-    ak_json__char StartChar = AK_Json__Stream_Consume_Char(Stream);
-    AK_JSON_ASSERT(StartChar.Char == '"');
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, '"', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '/',
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '\\', 0, 0, 0,
+    0, 0, '\b', 0, 0, 0, '\f', 0, 0, 0, 0, 0, 0, 0, '\n', 0,
+    0, 0, '\r', 0, '\t', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static unsigned int AK_Json__Hex_Value(ak_json_u8 C)
+{
+    if(C <= '9') return C - '0';
+    return (C | 0x20) - 'a' + 10;
+}
+
+static unsigned int AK_Json__Parse_UTF16(const ak_json_u8* Str)
+{
+    return (AK_Json__Hex_Value(Str[0]) << 12) | (AK_Json__Hex_Value(Str[1]) << 8) | 
+        (AK_Json__Hex_Value(Str[2]) << 4) | AK_Json__Hex_Value(Str[3]);
+}
+
+//NOTE(EVERYONE): Writes the decoded bytes of an escaped string body (no quotes, already validated by 
+//AK_Json__Scan_String) to Dst and returns how many were written. Runs between escapes are copied in bulk 
+//and only the escapes themselves are decoded. Decoding never makes a string longer, so Dst needs at most 
+//JsonStr.Length bytes
+static ak_json_u64 AK_Json__Decode_Json_Str(ak_json_u8* Dst, ak_json_str JsonStr)
+{
+    ak_json_u8* Start = Dst;
     
-    while(AK_Json__Stream_Is_Valid(Stream))
+    const ak_json_u8* Str = JsonStr.Str;
+    ak_json_u64 Length = JsonStr.Length;
+    ak_json_u64 Index = 0;
+    while(Index < Length)
     {
-        ak_json__char Char = AK_Json__Stream_Consume_Char(Stream);
+        ak_json_u64 EscapeIndex = AK_Json__Find_String_Special(Str, Index, Length);
+        AK_Json__Memory_Copy(Dst, Str+Index, EscapeIndex-Index);
+        Dst += EscapeIndex-Index;
+        Index = EscapeIndex;
+        if(Index >= Length) break;
         
-        if(Char.Char == '"')
+        AK_JSON_ASSERT(Str[Index] == '\\' && Index+1 < Length);
+        ak_json_u8 Escape = Str[Index+1];
+        ak_json_u8 Decoded = G_AK_Json__Escape_Table[Escape];
+        if(Decoded)
         {
-            ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_STRING, StartChar);
-            Token->Length = Stream->StrIndex-StartChar.Index;
-            return 1;
+            *Dst++ = Decoded;
+            Index += 2;
         }
-        else if(Char.Char == '\\')
+        else
         {
-            if(AK_Json__Stream_Is_Valid(Stream))
+            AK_JSON_ASSERT(Escape == 'u' && Index+6 <= Length);
+            unsigned int Codepoint = AK_Json__Parse_UTF16(Str+Index+2);
+            Index += 6;
+            
+            if(Codepoint >= 0xD800 && Codepoint < 0xDC00)
             {
-                ak_json__char ControlChar = AK_Json__Stream_Consume_Char(Stream);
-                switch(ControlChar.Char)
+                //NOTE(EVERYONE): A high surrogate needs to be followed by a low surrogate escape
+                unsigned int Low = 0;
+                if(Index+6 <= Length && Str[Index] == '\\' && Str[Index+1] == 'u')
+                    Low = AK_Json__Parse_UTF16(Str+Index+2);
+                
+                if(Low >= 0xDC00 && Low < 0xE000)
                 {
-                    case '"':
-                    case '\\':
-                    case 'b':
-                    case 'f':
-                    case 'n':
-                    case 'r':
-                    case 't':
-                    {
-                        //NOTE(EVERYONE): Noop. These are the valid control points
-                    } break;
-                    
-                    case 'u':
-                    {
-                        ak_json_u64 Remaining = AK_Json__Stream_Get_Remaining(Stream);
-                        if(Remaining >= 4)
-                        {
-                            ak_json_u64 Index;
-                            for(Index = 0; Index < 4; Index++)
-                            {
-                                ak_json__char UnicodeChar = AK_Json__Stream_Consume_Char(Stream);
-                                if(!AK_Json__Is_Hex_Digit(UnicodeChar.Char))
-                                    AK_Json__Return_Undefined(StartChar);
-                            }
-                        }
-                        else
-                        {
-                            AK_Json__Return_Undefined(StartChar);
-                        }
-                    } break;
-                    
-                    default:
-                    {
-                        AK_Json__Return_Undefined(StartChar);
-                    } break;
+                    Codepoint = 0x10000 + ((Codepoint-0xD800) << 10) + (Low-0xDC00);
+                    Index += 6;
+                }
+                else
+                {
+                    Codepoint = 0xFFFD;
                 }
             }
-            else
+            else if(Codepoint >= 0xDC00 && Codepoint < 0xE000)
             {
-                AK_Json__Return_Undefined(StartChar);
+                Codepoint = 0xFFFD;
             }
+            
+            Dst += AK_Json__UTF8_From_Codepoint(Codepoint, Dst);
         }
     }
     
-    AK_Json__Return_Undefined(StartChar);
+    return (ak_json_u64)(Dst-Start);
 }
 
-static int AK_Json__Tokenize_Value(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+//NOTE(EVERYONE): Strings without escapes are a single copy. Escaped strings are decoded straight into a 
+//reserve in the arena that only keeps the decoded length
+static ak_json_str AK_Json__Json_Str_To_UTF8(ak_json__arena* Arena, ak_json_str JsonStr, int HasEscapes)
 {
-    AK_Json__Stream_Eat_Whitespace(Stream);
+    ak_json_str Result;
+    if(!JsonStr.Length)
+    {
+        Result.Length = 0;
+        Result.Str = NULL;
+        return Result;
+    }
     
-    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    if(!HasEscapes) return AK_Json_Str__Copy(Arena, JsonStr);
     
-    int Result = 1;
-    switch(Char.Char)
+    ak_json__arena_reserve Reserve = AK_Json__Arena_Begin_Reserve(Arena, JsonStr.Length+1);
+    if(!Reserve.Arena)
     {
-        case 'n':
-        {
-            Result = AK_Json__Tokenize_Null(Tokenizer, Stream);
-            if(!Result)
-            {
-                AK_Json__Error_Log(Tokenizer->ErrorArena, Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting null value. Got undefined."));
-            }
-        } break;
+        Result.Length = 0;
+        Result.Str = NULL;
+        return Result;
+    }
+    
+    ak_json_u8* Buffer = AK_Json__Arena_Reserve_Get_Memory(&Reserve);
+    Result.Length = AK_Json__Decode_Json_Str(Buffer, JsonStr);
+    Buffer[Result.Length] = 0;
+    Result.Str = (const ak_json_u8*)Buffer;
+    
+    Reserve.Used = Result.Length+1;
+    AK_Json__Arena_End_Reserve(&Reserve);
+    
+    return Result;
+}
+
+/**************
+*** Numbers ***
+***************/
+
+//NOTE(EVERYONE): Numbers are converted with the Eisel-Lemire algorithm (the one fast_float uses) and never 
+//look past the token or at the locale. The digits are reduced to a mantissa of at most 19 significant digits 
+//and a power of ten. Exact small cases take Clinger's fast path, everything else is multiplied against a 
+//truncated 128 bit power of five. When more than 19 digits were given and the dropped digits could change 
+//the rounding, the full decimal is compared against the halfway point with a big integer
+#define AK_JSON__MIN_POWER_OF_TEN -342
+#define AK_JSON__MAX_POWER_OF_TEN 308
+#define AK_JSON__MAX_MANTISSA_DIGITS 19
+#define AK_JSON__MAX_DECIMAL_DIGITS 768
+#define AK_JSON__BIG_INT_LIMB_COUNT 128
+#define AK_JSON__DOUBLE_MANTISSA_BITS 52
+#define AK_JSON__DOUBLE_INFINITE_POWER 0x7FF
+
+//NOTE(EVERYONE): 5^q for q in [-342, 308], normalized so the top bit is set, as {High, Low} pairs
+static const ak_json_u64 G_AK_Json__Powers_Of_Five[] = 
+{
+    0xEEF453D6923BD65Aull, 0x113FAA2906A13B3Full,
+    0x9558B4661B6565F8ull, 0x4AC7CA59A424C507ull,
+    0xBAAEE17FA23EBF76ull, 0x5D79BCF00D2DF649ull,
+    0xE95A99DF8ACE6F53ull, 0xF4D82C2C107973DCull,
+    0x91D8A02BB6C10594ull, 0x79071B9B8A4BE869ull,
+    0xB64EC836A47146F9ull, 0x9748E2826CDEE284ull,
+    0xE3E27A444D8D98B7ull, 0xFD1B1B2308169B25ull,
+    0x8E6D8C6AB0787F72ull, 0xFE30F0F5E50E20F7ull,
+    0xB208EF855C969F4Full, 0xBDBD2D335E51A935ull,
+    0xDE8B2B66B3BC4723ull, 0xAD2C788035E61382ull,
+    0x8B16FB203055AC76ull, 0x4C3BCB5021AFCC31ull,
+    0xADDCB9E83C6B1793ull, 0xDF4ABE242A1BBF3Dull,
+    0xD953E8624B85DD78ull, 0xD71D6DAD34A2AF0Dull,
+    0x87D4713D6F33AA6Bull, 0x8672648C40E5AD68ull,
+    0xA9C98D8CCB009506ull, 0x680EFDAF511F18C2ull,
+    0xD43BF0EFFDC0BA48ull, 0x0212BD1B2566DEF2ull,
+    0x84A57695FE98746Dull, 0x014BB630F7604B57ull,
+    0xA5CED43B7E3E9188ull, 0x419EA3BD35385E2Dull,
+    0xCF42894A5DCE35EAull, 0x52064CAC828675B9ull,
+    0x818995CE7AA0E1B2ull, 0x7343EFEBD1940993ull,
+    0xA1EBFB4219491A1Full, 0x1014EBE6C5F90BF8ull,
+    0xCA66FA129F9B60A6ull, 0xD41A26E077774EF6ull,
+    0xFD00B897478238D0ull, 0x8920B098955522B4ull,
+    0x9E20735E8CB16382ull, 0x55B46E5F5D5535B0ull,
+    0xC5A890362FDDBC62ull, 0xEB2189F734AA831Dull,
+    0xF712B443BBD52B7Bull, 0xA5E9EC7501D523E4ull,
+    0x9A6BB0AA55653B2Dull, 0x47B233C92125366Eull,
+    0xC1069CD4EABE89F8ull, 0x999EC0BB696E840Aull,
+    0xF148440A256E2C76ull, 0xC00670EA43CA250Dull,
+    0x96CD2A865764DBCAull, 0x380406926A5E5728ull,
+    0xBC807527ED3E12BCull, 0xC605083704F5ECF2ull,
+    0xEBA09271E88D976Bull, 0xF7864A44C633682Eull,
+    0x93445B8731587EA3ull, 0x7AB3EE6AFBE0211Dull,
+    0xB8157268FDAE9E4Cull, 0x5960EA05BAD82964ull,
+    0xE61ACF033D1A45DFull, 0x6FB92487298E33BDull,
+    0x8FD0C16206306BABull, 0xA5D3B6D479F8E056ull,
+    0xB3C4F1BA87BC8696ull, 0x8F48A4899877186Cull,
+    0xE0B62E2929ABA83Cull, 0x331ACDABFE94DE87ull,
+    0x8C71DCD9BA0B4925ull, 0x9FF0C08B7F1D0B14ull,
+    0xAF8E5410288E1B6Full, 0x07ECF0AE5EE44DD9ull,
+    0xDB71E91432B1A24Aull, 0xC9E82CD9F69D6150ull,
+    0x892731AC9FAF056Eull, 0xBE311C083A225CD2ull,
+    0xAB70FE17C79AC6CAull, 0x6DBD630A48AAF406ull,
+    0xD64D3D9DB981787Dull, 0x092CBBCCDAD5B108ull,
+    0x85F0468293F0EB4Eull, 0x25BBF56008C58EA5ull,
+    0xA76C582338ED2621ull, 0xAF2AF2B80AF6F24Eull,
+    0xD1476E2C07286FAAull, 0x1AF5AF660DB4AEE1ull,
+    0x82CCA4DB847945CAull, 0x50D98D9FC890ED4Dull,
+    0xA37FCE126597973Cull, 0xE50FF107BAB528A0ull,
+    0xCC5FC196FEFD7D0Cull, 0x1E53ED49A96272C8ull,
+    0xFF77B1FCBEBCDC4Full, 0x25E8E89C13BB0F7Aull,
+    0x9FAACF3DF73609B1ull, 0x77B191618C54E9ACull,
+    0xC795830D75038C1Dull, 0xD59DF5B9EF6A2417ull,
+    0xF97AE3D0D2446F25ull, 0x4B0573286B44AD1Dull,
+    0x9BECCE62836AC577ull, 0x4EE367F9430AEC32ull,
+    0xC2E801FB244576D5ull, 0x229C41F793CDA73Full,
+    0xF3A20279ED56D48Aull, 0x6B43527578C1110Full,
+    0x9845418C345644D6ull, 0x830A13896B78AAA9ull,
+    0xBE5691EF416BD60Cull, 0x23CC986BC656D553ull,
+    0xEDEC366B11C6CB8Full, 0x2CBFBE86B7EC8AA8ull,
+    0x94B3A202EB1C3F39ull, 0x7BF7D71432F3D6A9ull,
+    0xB9E08A83A5E34F07ull, 0xDAF5CCD93FB0CC53ull,
+    0xE858AD248F5C22C9ull, 0xD1B3400F8F9CFF68ull,
+    0x91376C36D99995BEull, 0x23100809B9C21FA1ull,
+    0xB58547448FFFFB2Dull, 0xABD40A0C2832A78Aull,
+    0xE2E69915B3FFF9F9ull, 0x16C90C8F323F516Cull,
+    0x8DD01FAD907FFC3Bull, 0xAE3DA7D97F6792E3ull,
+    0xB1442798F49FFB4Aull, 0x99CD11CFDF41779Cull,
+    0xDD95317F31C7FA1Dull, 0x40405643D711D583ull,
+    0x8A7D3EEF7F1CFC52ull, 0x482835EA666B2572ull,
+    0xAD1C8EAB5EE43B66ull, 0xDA3243650005EECFull,
+    0xD863B256369D4A40ull, 0x90BED43E40076A82ull,
+    0x873E4F75E2224E68ull, 0x5A7744A6E804A291ull,
+    0xA90DE3535AAAE202ull, 0x711515D0A205CB36ull,
+    0xD3515C2831559A83ull, 0x0D5A5B44CA873E03ull,
+    0x8412D9991ED58091ull, 0xE858790AFE9486C2ull,
+    0xA5178FFF668AE0B6ull, 0x626E974DBE39A872ull,
+    0xCE5D73FF402D98E3ull, 0xFB0A3D212DC8128Full,
+    0x80FA687F881C7F8Eull, 0x7CE66634BC9D0B99ull,
+    0xA139029F6A239F72ull, 0x1C1FFFC1EBC44E80ull,
+    0xC987434744AC874Eull, 0xA327FFB266B56220ull,
+    0xFBE9141915D7A922ull, 0x4BF1FF9F0062BAA8ull,
+    0x9D71AC8FADA6C9B5ull, 0x6F773FC3603DB4A9ull,
+    0xC4CE17B399107C22ull, 0xCB550FB4384D21D3ull,
+    0xF6019DA07F549B2Bull, 0x7E2A53A146606A48ull,
+    0x99C102844F94E0FBull, 0x2EDA7444CBFC426Dull,
+    0xC0314325637A1939ull, 0xFA911155FEFB5308ull,
+    0xF03D93EEBC589F88ull, 0x793555AB7EBA27CAull,
+    0x96267C7535B763B5ull, 0x4BC1558B2F3458DEull,
+    0xBBB01B9283253CA2ull, 0x9EB1AAEDFB016F16ull,
+    0xEA9C227723EE8BCBull, 0x465E15A979C1CADCull,
+    0x92A1958A7675175Full, 0x0BFACD89EC191EC9ull,
+    0xB749FAED14125D36ull, 0xCEF980EC671F667Bull,
+    0xE51C79A85916F484ull, 0x82B7E12780E7401Aull,
+    0x8F31CC0937AE58D2ull, 0xD1B2ECB8B0908810ull,
+    0xB2FE3F0B8599EF07ull, 0x861FA7E6DCB4AA15ull,
+    0xDFBDCECE67006AC9ull, 0x67A791E093E1D49Aull,
+    0x8BD6A141006042BDull, 0xE0C8BB2C5C6D24E0ull,
+    0xAECC49914078536Dull, 0x58FAE9F773886E18ull,
+    0xDA7F5BF590966848ull, 0xAF39A475506A899Eull,
+    0x888F99797A5E012Dull, 0x6D8406C952429603ull,
+    0xAAB37FD7D8F58178ull, 0xC8E5087BA6D33B83ull,
+    0xD5605FCDCF32E1D6ull, 0xFB1E4A9A90880A64ull,
+    0x855C3BE0A17FCD26ull, 0x5CF2EEA09A55067Full,
+    0xA6B34AD8C9DFC06Full, 0xF42FAA48C0EA481Eull,
+    0xD0601D8EFC57B08Bull, 0xF13B94DAF124DA26ull,
+    0x823C12795DB6CE57ull, 0x76C53D08D6B70858ull,
+    0xA2CB1717B52481EDull, 0x54768C4B0C64CA6Eull,
+    0xCB7DDCDDA26DA268ull, 0xA9942F5DCF7DFD09ull,
+    0xFE5D54150B090B02ull, 0xD3F93B35435D7C4Cull,
+    0x9EFA548D26E5A6E1ull, 0xC47BC5014A1A6DAFull,
+    0xC6B8E9B0709F109Aull, 0x359AB6419CA1091Bull,
+    0xF867241C8CC6D4C0ull, 0xC30163D203C94B62ull,
+    0x9B407691D7FC44F8ull, 0x79E0DE63425DCF1Dull,
+    0xC21094364DFB5636ull, 0x985915FC12F542E4ull,
+    0xF294B943E17A2BC4ull, 0x3E6F5B7B17B2939Dull,
+    0x979CF3CA6CEC5B5Aull, 0xA705992CEECF9C42ull,
+    0xBD8430BD08277231ull, 0x50C6FF782A838353ull,
+    0xECE53CEC4A314EBDull, 0xA4F8BF5635246428ull,
+    0x940F4613AE5ED136ull, 0x871B7795E136BE99ull,
+    0xB913179899F68584ull, 0x28E2557B59846E3Full,
+    0xE757DD7EC07426E5ull, 0x331AEADA2FE589CFull,
+    0x9096EA6F3848984Full, 0x3FF0D2C85DEF7621ull,
+    0xB4BCA50B065ABE63ull, 0x0FED077A756B53A9ull,
+    0xE1EBCE4DC7F16DFBull, 0xD3E8495912C62894ull,
+    0x8D3360F09CF6E4BDull, 0x64712DD7ABBBD95Cull,
+    0xB080392CC4349DECull, 0xBD8D794D96AACFB3ull,
+    0xDCA04777F541C567ull, 0xECF0D7A0FC5583A0ull,
+    0x89E42CAAF9491B60ull, 0xF41686C49DB57244ull,
+    0xAC5D37D5B79B6239ull, 0x311C2875C522CED5ull,
+    0xD77485CB25823AC7ull, 0x7D633293366B828Bull,
+    0x86A8D39EF77164BCull, 0xAE5DFF9C02033197ull,
+    0xA8530886B54DBDEBull, 0xD9F57F830283FDFCull,
+    0xD267CAA862A12D66ull, 0xD072DF63C324FD7Bull,
+    0x8380DEA93DA4BC60ull, 0x4247CB9E59F71E6Dull,
+    0xA46116538D0DEB78ull, 0x52D9BE85F074E608ull,
+    0xCD795BE870516656ull, 0x67902E276C921F8Bull,
+    0x806BD9714632DFF6ull, 0x00BA1CD8A3DB53B6ull,
+    0xA086CFCD97BF97F3ull, 0x80E8A40ECCD228A4ull,
+    0xC8A883C0FDAF7DF0ull, 0x6122CD128006B2CDull,
+    0xFAD2A4B13D1B5D6Cull, 0x796B805720085F81ull,
+    0x9CC3A6EEC6311A63ull, 0xCBE3303674053BB0ull,
+    0xC3F490AA77BD60FCull, 0xBEDBFC4411068A9Cull,
+    0xF4F1B4D515ACB93Bull, 0xEE92FB5515482D44ull,
+    0x991711052D8BF3C5ull, 0x751BDD152D4D1C4Aull,
+    0xBF5CD54678EEF0B6ull, 0xD262D45A78A0635Dull,
+    0xEF340A98172AACE4ull, 0x86FB897116C87C34ull,
+    0x9580869F0E7AAC0Eull, 0xD45D35E6AE3D4DA0ull,
+    0xBAE0A846D2195712ull, 0x8974836059CCA109ull,
+    0xE998D258869FACD7ull, 0x2BD1A438703FC94Bull,
+    0x91FF83775423CC06ull, 0x7B6306A34627DDCFull,
+    0xB67F6455292CBF08ull, 0x1A3BC84C17B1D542ull,
+    0xE41F3D6A7377EECAull, 0x20CABA5F1D9E4A93ull,
+    0x8E938662882AF53Eull, 0x547EB47B7282EE9Cull,
+    0xB23867FB2A35B28Dull, 0xE99E619A4F23AA43ull,
+    0xDEC681F9F4C31F31ull, 0x6405FA00E2EC94D4ull,
+    0x8B3C113C38F9F37Eull, 0xDE83BC408DD3DD04ull,
+    0xAE0B158B4738705Eull, 0x9624AB50B148D445ull,
+    0xD98DDAEE19068C76ull, 0x3BADD624DD9B0957ull,
+    0x87F8A8D4CFA417C9ull, 0xE54CA5D70A80E5D6ull,
+    0xA9F6D30A038D1DBCull, 0x5E9FCF4CCD211F4Cull,
+    0xD47487CC8470652Bull, 0x7647C3200069671Full,
+    0x84C8D4DFD2C63F3Bull, 0x29ECD9F40041E073ull,
+    0xA5FB0A17C777CF09ull, 0xF468107100525890ull,
+    0xCF79CC9DB955C2CCull, 0x7182148D4066EEB4ull,
+    0x81AC1FE293D599BFull, 0xC6F14CD848405530ull,
+    0xA21727DB38CB002Full, 0xB8ADA00E5A506A7Cull,
+    0xCA9CF1D206FDC03Bull, 0xA6D90811F0E4851Cull,
+    0xFD442E4688BD304Aull, 0x908F4A166D1DA663ull,
+    0x9E4A9CEC15763E2Eull, 0x9A598E4E043287FEull,
+    0xC5DD44271AD3CDBAull, 0x40EFF1E1853F29FDull,
+    0xF7549530E188C128ull, 0xD12BEE59E68EF47Cull,
+    0x9A94DD3E8CF578B9ull, 0x82BB74F8301958CEull,
+    0xC13A148E3032D6E7ull, 0xE36A52363C1FAF01ull,
+    0xF18899B1BC3F8CA1ull, 0xDC44E6C3CB279AC1ull,
+    0x96F5600F15A7B7E5ull, 0x29AB103A5EF8C0B9ull,
+    0xBCB2B812DB11A5DEull, 0x7415D448F6B6F0E7ull,
+    0xEBDF661791D60F56ull, 0x111B495B3464AD21ull,
+    0x936B9FCEBB25C995ull, 0xCAB10DD900BEEC34ull,
+    0xB84687C269EF3BFBull, 0x3D5D514F40EEA742ull,
+    0xE65829B3046B0AFAull, 0x0CB4A5A3112A5112ull,
+    0x8FF71A0FE2C2E6DCull, 0x47F0E785EABA72ABull,
+    0xB3F4E093DB73A093ull, 0x59ED216765690F56ull,
+    0xE0F218B8D25088B8ull, 0x306869C13EC3532Cull,
+    0x8C974F7383725573ull, 0x1E414218C73A13FBull,
+    0xAFBD2350644EEACFull, 0xE5D1929EF90898FAull,
+    0xDBAC6C247D62A583ull, 0xDF45F746B74ABF39ull,
+    0x894BC396CE5DA772ull, 0x6B8BBA8C328EB783ull,
+    0xAB9EB47C81F5114Full, 0x066EA92F3F326564ull,
+    0xD686619BA27255A2ull, 0xC80A537B0EFEFEBDull,
+    0x8613FD0145877585ull, 0xBD06742CE95F5F36ull,
+    0xA798FC4196E952E7ull, 0x2C48113823B73704ull,
+    0xD17F3B51FCA3A7A0ull, 0xF75A15862CA504C5ull,
+    0x82EF85133DE648C4ull, 0x9A984D73DBE722FBull,
+    0xA3AB66580D5FDAF5ull, 0xC13E60D0D2E0EBBAull,
+    0xCC963FEE10B7D1B3ull, 0x318DF905079926A8ull,
+    0xFFBBCFE994E5C61Full, 0xFDF17746497F7052ull,
+    0x9FD561F1FD0F9BD3ull, 0xFEB6EA8BEDEFA633ull,
+    0xC7CABA6E7C5382C8ull, 0xFE64A52EE96B8FC0ull,
+    0xF9BD690A1B68637Bull, 0x3DFDCE7AA3C673B0ull,
+    0x9C1661A651213E2Dull, 0x06BEA10CA65C084Eull,
+    0xC31BFA0FE5698DB8ull, 0x486E494FCFF30A62ull,
+    0xF3E2F893DEC3F126ull, 0x5A89DBA3C3EFCCFAull,
+    0x986DDB5C6B3A76B7ull, 0xF89629465A75E01Cull,
+    0xBE89523386091465ull, 0xF6BBB397F1135823ull,
+    0xEE2BA6C0678B597Full, 0x746AA07DED582E2Cull,
+    0x94DB483840B717EFull, 0xA8C2A44EB4571CDCull,
+    0xBA121A4650E4DDEBull, 0x92F34D62616CE413ull,
+    0xE896A0D7E51E1566ull, 0x77B020BAF9C81D17ull,
+    0x915E2486EF32CD60ull, 0x0ACE1474DC1D122Eull,
+    0xB5B5ADA8AAFF80B8ull, 0x0D819992132456BAull,
+    0xE3231912D5BF60E6ull, 0x10E1FFF697ED6C69ull,
+    0x8DF5EFABC5979C8Full, 0xCA8D3FFA1EF463C1ull,
+    0xB1736B96B6FD83B3ull, 0xBD308FF8A6B17CB2ull,
+    0xDDD0467C64BCE4A0ull, 0xAC7CB3F6D05DDBDEull,
+    0x8AA22C0DBEF60EE4ull, 0x6BCDF07A423AA96Bull,
+    0xAD4AB7112EB3929Dull, 0x86C16C98D2C953C6ull,
+    0xD89D64D57A607744ull, 0xE871C7BF077BA8B7ull,
+    0x87625F056C7C4A8Bull, 0x11471CD764AD4972ull,
+    0xA93AF6C6C79B5D2Dull, 0xD598E40D3DD89BCFull,
+    0xD389B47879823479ull, 0x4AFF1D108D4EC2C3ull,
+    0x843610CB4BF160CBull, 0xCEDF722A585139BAull,
+    0xA54394FE1EEDB8FEull, 0xC2974EB4EE658828ull,
+    0xCE947A3DA6A9273Eull, 0x733D226229FEEA32ull,
+    0x811CCC668829B887ull, 0x0806357D5A3F525Full,
+    0xA163FF802A3426A8ull, 0xCA07C2DCB0CF26F7ull,
+    0xC9BCFF6034C13052ull, 0xFC89B393DD02F0B5ull,
+    0xFC2C3F3841F17C67ull, 0xBBAC2078D443ACE2ull,
+    0x9D9BA7832936EDC0ull, 0xD54B944B84AA4C0Dull,
+    0xC5029163F384A931ull, 0x0A9E795E65D4DF11ull,
+    0xF64335BCF065D37Dull, 0x4D4617B5FF4A16D5ull,
+    0x99EA0196163FA42Eull, 0x504BCED1BF8E4E45ull,
+    0xC06481FB9BCF8D39ull, 0xE45EC2862F71E1D6ull,
+    0xF07DA27A82C37088ull, 0x5D767327BB4E5A4Cull,
+    0x964E858C91BA2655ull, 0x3A6A07F8D510F86Full,
+    0xBBE226EFB628AFEAull, 0x890489F70A55368Bull,
+    0xEADAB0ABA3B2DBE5ull, 0x2B45AC74CCEA842Eull,
+    0x92C8AE6B464FC96Full, 0x3B0B8BC90012929Dull,
+    0xB77ADA0617E3BBCBull, 0x09CE6EBB40173744ull,
+    0xE55990879DDCAABDull, 0xCC420A6A101D0515ull,
+    0x8F57FA54C2A9EAB6ull, 0x9FA946824A12232Dull,
+    0xB32DF8E9F3546564ull, 0x47939822DC96ABF9ull,
+    0xDFF9772470297EBDull, 0x59787E2B93BC56F7ull,
+    0x8BFBEA76C619EF36ull, 0x57EB4EDB3C55B65Aull,
+    0xAEFAE51477A06B03ull, 0xEDE622920B6B23F1ull,
+    0xDAB99E59958885C4ull, 0xE95FAB368E45ECEDull,
+    0x88B402F7FD75539Bull, 0x11DBCB0218EBB414ull,
+    0xAAE103B5FCD2A881ull, 0xD652BDC29F26A119ull,
+    0xD59944A37C0752A2ull, 0x4BE76D3346F0495Full,
+    0x857FCAE62D8493A5ull, 0x6F70A4400C562DDBull,
+    0xA6DFBD9FB8E5B88Eull, 0xCB4CCD500F6BB952ull,
+    0xD097AD07A71F26B2ull, 0x7E2000A41346A7A7ull,
+    0x825ECC24C873782Full, 0x8ED400668C0C28C8ull,
+    0xA2F67F2DFA90563Bull, 0x728900802F0F32FAull,
+    0xCBB41EF979346BCAull, 0x4F2B40A03AD2FFB9ull,
+    0xFEA126B7D78186BCull, 0xE2F610C84987BFA8ull,
+    0x9F24B832E6B0F436ull, 0x0DD9CA7D2DF4D7C9ull,
+    0xC6EDE63FA05D3143ull, 0x91503D1C79720DBBull,
+    0xF8A95FCF88747D94ull, 0x75A44C6397CE912Aull,
+    0x9B69DBE1B548CE7Cull, 0xC986AFBE3EE11ABAull,
+    0xC24452DA229B021Bull, 0xFBE85BADCE996168ull,
+    0xF2D56790AB41C2A2ull, 0xFAE27299423FB9C3ull,
+    0x97C560BA6B0919A5ull, 0xDCCD879FC967D41Aull,
+    0xBDB6B8E905CB600Full, 0x5400E987BBC1C920ull,
+    0xED246723473E3813ull, 0x290123E9AAB23B68ull,
+    0x9436C0760C86E30Bull, 0xF9A0B6720AAF6521ull,
+    0xB94470938FA89BCEull, 0xF808E40E8D5B3E69ull,
+    0xE7958CB87392C2C2ull, 0xB60B1D1230B20E04ull,
+    0x90BD77F3483BB9B9ull, 0xB1C6F22B5E6F48C2ull,
+    0xB4ECD5F01A4AA828ull, 0x1E38AEB6360B1AF3ull,
+    0xE2280B6C20DD5232ull, 0x25C6DA63C38DE1B0ull,
+    0x8D590723948A535Full, 0x579C487E5A38AD0Eull,
+    0xB0AF48EC79ACE837ull, 0x2D835A9DF0C6D851ull,
+    0xDCDB1B2798182244ull, 0xF8E431456CF88E65ull,
+    0x8A08F0F8BF0F156Bull, 0x1B8E9ECB641B58FFull,
+    0xAC8B2D36EED2DAC5ull, 0xE272467E3D222F3Full,
+    0xD7ADF884AA879177ull, 0x5B0ED81DCC6ABB0Full,
+    0x86CCBB52EA94BAEAull, 0x98E947129FC2B4E9ull,
+    0xA87FEA27A539E9A5ull, 0x3F2398D747B36224ull,
+    0xD29FE4B18E88640Eull, 0x8EEC7F0D19A03AADull,
+    0x83A3EEEEF9153E89ull, 0x1953CF68300424ACull,
+    0xA48CEAAAB75A8E2Bull, 0x5FA8C3423C052DD7ull,
+    0xCDB02555653131B6ull, 0x3792F412CB06794Dull,
+    0x808E17555F3EBF11ull, 0xE2BBD88BBEE40BD0ull,
+    0xA0B19D2AB70E6ED6ull, 0x5B6ACEAEAE9D0EC4ull,
+    0xC8DE047564D20A8Bull, 0xF245825A5A445275ull,
+    0xFB158592BE068D2Eull, 0xEED6E2F0F0D56712ull,
+    0x9CED737BB6C4183Dull, 0x55464DD69685606Bull,
+    0xC428D05AA4751E4Cull, 0xAA97E14C3C26B886ull,
+    0xF53304714D9265DFull, 0xD53DD99F4B3066A8ull,
+    0x993FE2C6D07B7FABull, 0xE546A8038EFE4029ull,
+    0xBF8FDB78849A5F96ull, 0xDE98520472BDD033ull,
+    0xEF73D256A5C0F77Cull, 0x963E66858F6D4440ull,
+    0x95A8637627989AADull, 0xDDE7001379A44AA8ull,
+    0xBB127C53B17EC159ull, 0x5560C018580D5D52ull,
+    0xE9D71B689DDE71AFull, 0xAAB8F01E6E10B4A6ull,
+    0x9226712162AB070Dull, 0xCAB3961304CA70E8ull,
+    0xB6B00D69BB55C8D1ull, 0x3D607B97C5FD0D22ull,
+    0xE45C10C42A2B3B05ull, 0x8CB89A7DB77C506Aull,
+    0x8EB98A7A9A5B04E3ull, 0x77F3608E92ADB242ull,
+    0xB267ED1940F1C61Cull, 0x55F038B237591ED3ull,
+    0xDF01E85F912E37A3ull, 0x6B6C46DEC52F6688ull,
+    0x8B61313BBABCE2C6ull, 0x2323AC4B3B3DA015ull,
+    0xAE397D8AA96C1B77ull, 0xABEC975E0A0D081Aull,
+    0xD9C7DCED53C72255ull, 0x96E7BD358C904A21ull,
+    0x881CEA14545C7575ull, 0x7E50D64177DA2E54ull,
+    0xAA242499697392D2ull, 0xDDE50BD1D5D0B9E9ull,
+    0xD4AD2DBFC3D07787ull, 0x955E4EC64B44E864ull,
+    0x84EC3C97DA624AB4ull, 0xBD5AF13BEF0B113Eull,
+    0xA6274BBDD0FADD61ull, 0xECB1AD8AEACDD58Eull,
+    0xCFB11EAD453994BAull, 0x67DE18EDA5814AF2ull,
+    0x81CEB32C4B43FCF4ull, 0x80EACF948770CED7ull,
+    0xA2425FF75E14FC31ull, 0xA1258379A94D028Dull,
+    0xCAD2F7F5359A3B3Eull, 0x096EE45813A04330ull,
+    0xFD87B5F28300CA0Dull, 0x8BCA9D6E188853FCull,
+    0x9E74D1B791E07E48ull, 0x775EA264CF55347Eull,
+    0xC612062576589DDAull, 0x95364AFE032A819Eull,
+    0xF79687AED3EEC551ull, 0x3A83DDBD83F52205ull,
+    0x9ABE14CD44753B52ull, 0xC4926A9672793543ull,
+    0xC16D9A0095928A27ull, 0x75B7053C0F178294ull,
+    0xF1C90080BAF72CB1ull, 0x5324C68B12DD6339ull,
+    0x971DA05074DA7BEEull, 0xD3F6FC16EBCA5E04ull,
+    0xBCE5086492111AEAull, 0x88F4BB1CA6BCF585ull,
+    0xEC1E4A7DB69561A5ull, 0x2B31E9E3D06C32E6ull,
+    0x9392EE8E921D5D07ull, 0x3AFF322E62439FD0ull,
+    0xB877AA3236A4B449ull, 0x09BEFEB9FAD487C3ull,
+    0xE69594BEC44DE15Bull, 0x4C2EBE687989A9B4ull,
+    0x901D7CF73AB0ACD9ull, 0x0F9D37014BF60A11ull,
+    0xB424DC35095CD80Full, 0x538484C19EF38C95ull,
+    0xE12E13424BB40E13ull, 0x2865A5F206B06FBAull,
+    0x8CBCCC096F5088CBull, 0xF93F87B7442E45D4ull,
+    0xAFEBFF0BCB24AAFEull, 0xF78F69A51539D749ull,
+    0xDBE6FECEBDEDD5BEull, 0xB573440E5A884D1Cull,
+    0x89705F4136B4A597ull, 0x31680A88F8953031ull,
+    0xABCC77118461CEFCull, 0xFDC20D2B36BA7C3Eull,
+    0xD6BF94D5E57A42BCull, 0x3D32907604691B4Dull,
+    0x8637BD05AF6C69B5ull, 0xA63F9A49C2C1B110ull,
+    0xA7C5AC471B478423ull, 0x0FCF80DC33721D54ull,
+    0xD1B71758E219652Bull, 0xD3C36113404EA4A9ull,
+    0x83126E978D4FDF3Bull, 0x645A1CAC083126EAull,
+    0xA3D70A3D70A3D70Aull, 0x3D70A3D70A3D70A4ull,
+    0xCCCCCCCCCCCCCCCCull, 0xCCCCCCCCCCCCCCCDull,
+    0x8000000000000000ull, 0x0000000000000000ull,
+    0xA000000000000000ull, 0x0000000000000000ull,
+    0xC800000000000000ull, 0x0000000000000000ull,
+    0xFA00000000000000ull, 0x0000000000000000ull,
+    0x9C40000000000000ull, 0x0000000000000000ull,
+    0xC350000000000000ull, 0x0000000000000000ull,
+    0xF424000000000000ull, 0x0000000000000000ull,
+    0x9896800000000000ull, 0x0000000000000000ull,
+    0xBEBC200000000000ull, 0x0000000000000000ull,
+    0xEE6B280000000000ull, 0x0000000000000000ull,
+    0x9502F90000000000ull, 0x0000000000000000ull,
+    0xBA43B74000000000ull, 0x0000000000000000ull,
+    0xE8D4A51000000000ull, 0x0000000000000000ull,
+    0x9184E72A00000000ull, 0x0000000000000000ull,
+    0xB5E620F480000000ull, 0x0000000000000000ull,
+    0xE35FA931A0000000ull, 0x0000000000000000ull,
+    0x8E1BC9BF04000000ull, 0x0000000000000000ull,
+    0xB1A2BC2EC5000000ull, 0x0000000000000000ull,
+    0xDE0B6B3A76400000ull, 0x0000000000000000ull,
+    0x8AC7230489E80000ull, 0x0000000000000000ull,
+    0xAD78EBC5AC620000ull, 0x0000000000000000ull,
+    0xD8D726B7177A8000ull, 0x0000000000000000ull,
+    0x878678326EAC9000ull, 0x0000000000000000ull,
+    0xA968163F0A57B400ull, 0x0000000000000000ull,
+    0xD3C21BCECCEDA100ull, 0x0000000000000000ull,
+    0x84595161401484A0ull, 0x0000000000000000ull,
+    0xA56FA5B99019A5C8ull, 0x0000000000000000ull,
+    0xCECB8F27F4200F3Aull, 0x0000000000000000ull,
+    0x813F3978F8940984ull, 0x4000000000000000ull,
+    0xA18F07D736B90BE5ull, 0x5000000000000000ull,
+    0xC9F2C9CD04674EDEull, 0xA400000000000000ull,
+    0xFC6F7C4045812296ull, 0x4D00000000000000ull,
+    0x9DC5ADA82B70B59Dull, 0xF020000000000000ull,
+    0xC5371912364CE305ull, 0x6C28000000000000ull,
+    0xF684DF56C3E01BC6ull, 0xC732000000000000ull,
+    0x9A130B963A6C115Cull, 0x3C7F400000000000ull,
+    0xC097CE7BC90715B3ull, 0x4B9F100000000000ull,
+    0xF0BDC21ABB48DB20ull, 0x1E86D40000000000ull,
+    0x96769950B50D88F4ull, 0x1314448000000000ull,
+    0xBC143FA4E250EB31ull, 0x17D955A000000000ull,
+    0xEB194F8E1AE525FDull, 0x5DCFAB0800000000ull,
+    0x92EFD1B8D0CF37BEull, 0x5AA1CAE500000000ull,
+    0xB7ABC627050305ADull, 0xF14A3D9E40000000ull,
+    0xE596B7B0C643C719ull, 0x6D9CCD05D0000000ull,
+    0x8F7E32CE7BEA5C6Full, 0xE4820023A2000000ull,
+    0xB35DBF821AE4F38Bull, 0xDDA2802C8A800000ull,
+    0xE0352F62A19E306Eull, 0xD50B2037AD200000ull,
+    0x8C213D9DA502DE45ull, 0x4526F422CC340000ull,
+    0xAF298D050E4395D6ull, 0x9670B12B7F410000ull,
+    0xDAF3F04651D47B4Cull, 0x3C0CDD765F114000ull,
+    0x88D8762BF324CD0Full, 0xA5880A69FB6AC800ull,
+    0xAB0E93B6EFEE0053ull, 0x8EEA0D047A457A00ull,
+    0xD5D238A4ABE98068ull, 0x72A4904598D6D880ull,
+    0x85A36366EB71F041ull, 0x47A6DA2B7F864750ull,
+    0xA70C3C40A64E6C51ull, 0x999090B65F67D924ull,
+    0xD0CF4B50CFE20765ull, 0xFFF4B4E3F741CF6Dull,
+    0x82818F1281ED449Full, 0xBFF8F10E7A8921A4ull,
+    0xA321F2D7226895C7ull, 0xAFF72D52192B6A0Dull,
+    0xCBEA6F8CEB02BB39ull, 0x9BF4F8A69F764490ull,
+    0xFEE50B7025C36A08ull, 0x02F236D04753D5B4ull,
+    0x9F4F2726179A2245ull, 0x01D762422C946590ull,
+    0xC722F0EF9D80AAD6ull, 0x424D3AD2B7B97EF5ull,
+    0xF8EBAD2B84E0D58Bull, 0xD2E0898765A7DEB2ull,
+    0x9B934C3B330C8577ull, 0x63CC55F49F88EB2Full,
+    0xC2781F49FFCFA6D5ull, 0x3CBF6B71C76B25FBull,
+    0xF316271C7FC3908Aull, 0x8BEF464E3945EF7Aull,
+    0x97EDD871CFDA3A56ull, 0x97758BF0E3CBB5ACull,
+    0xBDE94E8E43D0C8ECull, 0x3D52EEED1CBEA317ull,
+    0xED63A231D4C4FB27ull, 0x4CA7AAA863EE4BDDull,
+    0x945E455F24FB1CF8ull, 0x8FE8CAA93E74EF6Aull,
+    0xB975D6B6EE39E436ull, 0xB3E2FD538E122B44ull,
+    0xE7D34C64A9C85D44ull, 0x60DBBCA87196B616ull,
+    0x90E40FBEEA1D3A4Aull, 0xBC8955E946FE31CDull,
+    0xB51D13AEA4A488DDull, 0x6BABAB6398BDBE41ull,
+    0xE264589A4DCDAB14ull, 0xC696963C7EED2DD1ull,
+    0x8D7EB76070A08AECull, 0xFC1E1DE5CF543CA2ull,
+    0xB0DE65388CC8ADA8ull, 0x3B25A55F43294BCBull,
+    0xDD15FE86AFFAD912ull, 0x49EF0EB713F39EBEull,
+    0x8A2DBF142DFCC7ABull, 0x6E3569326C784337ull,
+    0xACB92ED9397BF996ull, 0x49C2C37F07965404ull,
+    0xD7E77A8F87DAF7FBull, 0xDC33745EC97BE906ull,
+    0x86F0AC99B4E8DAFDull, 0x69A028BB3DED71A3ull,
+    0xA8ACD7C0222311BCull, 0xC40832EA0D68CE0Cull,
+    0xD2D80DB02AABD62Bull, 0xF50A3FA490C30190ull,
+    0x83C7088E1AAB65DBull, 0x792667C6DA79E0FAull,
+    0xA4B8CAB1A1563F52ull, 0x577001B891185938ull,
+    0xCDE6FD5E09ABCF26ull, 0xED4C0226B55E6F86ull,
+    0x80B05E5AC60B6178ull, 0x544F8158315B05B4ull,
+    0xA0DC75F1778E39D6ull, 0x696361AE3DB1C721ull,
+    0xC913936DD571C84Cull, 0x03BC3A19CD1E38E9ull,
+    0xFB5878494ACE3A5Full, 0x04AB48A04065C723ull,
+    0x9D174B2DCEC0E47Bull, 0x62EB0D64283F9C76ull,
+    0xC45D1DF942711D9Aull, 0x3BA5D0BD324F8394ull,
+    0xF5746577930D6500ull, 0xCA8F44EC7EE36479ull,
+    0x9968BF6ABBE85F20ull, 0x7E998B13CF4E1ECBull,
+    0xBFC2EF456AE276E8ull, 0x9E3FEDD8C321A67Eull,
+    0xEFB3AB16C59B14A2ull, 0xC5CFE94EF3EA101Eull,
+    0x95D04AEE3B80ECE5ull, 0xBBA1F1D158724A12ull,
+    0xBB445DA9CA61281Full, 0x2A8A6E45AE8EDC97ull,
+    0xEA1575143CF97226ull, 0xF52D09D71A3293BDull,
+    0x924D692CA61BE758ull, 0x593C2626705F9C56ull,
+    0xB6E0C377CFA2E12Eull, 0x6F8B2FB00C77836Cull,
+    0xE498F455C38B997Aull, 0x0B6DFB9C0F956447ull,
+    0x8EDF98B59A373FECull, 0x4724BD4189BD5EACull,
+    0xB2977EE300C50FE7ull, 0x58EDEC91EC2CB657ull,
+    0xDF3D5E9BC0F653E1ull, 0x2F2967B66737E3EDull,
+    0x8B865B215899F46Cull, 0xBD79E0D20082EE74ull,
+    0xAE67F1E9AEC07187ull, 0xECD8590680A3AA11ull,
+    0xDA01EE641A708DE9ull, 0xE80E6F4820CC9495ull,
+    0x884134FE908658B2ull, 0x3109058D147FDCDDull,
+    0xAA51823E34A7EEDEull, 0xBD4B46F0599FD415ull,
+    0xD4E5E2CDC1D1EA96ull, 0x6C9E18AC7007C91Aull,
+    0x850FADC09923329Eull, 0x03E2CF6BC604DDB0ull,
+    0xA6539930BF6BFF45ull, 0x84DB8346B786151Cull,
+    0xCFE87F7CEF46FF16ull, 0xE612641865679A63ull,
+    0x81F14FAE158C5F6Eull, 0x4FCB7E8F3F60C07Eull,
+    0xA26DA3999AEF7749ull, 0xE3BE5E330F38F09Dull,
+    0xCB090C8001AB551Cull, 0x5CADF5BFD3072CC5ull,
+    0xFDCB4FA002162A63ull, 0x73D9732FC7C8F7F6ull,
+    0x9E9F11C4014DDA7Eull, 0x2867E7FDDCDD9AFAull,
+    0xC646D63501A1511Dull, 0xB281E1FD541501B8ull,
+    0xF7D88BC24209A565ull, 0x1F225A7CA91A4226ull,
+    0x9AE757596946075Full, 0x3375788DE9B06958ull,
+    0xC1A12D2FC3978937ull, 0x0052D6B1641C83AEull,
+    0xF209787BB47D6B84ull, 0xC0678C5DBD23A49Aull,
+    0x9745EB4D50CE6332ull, 0xF840B7BA963646E0ull,
+    0xBD176620A501FBFFull, 0xB650E5A93BC3D898ull,
+    0xEC5D3FA8CE427AFFull, 0xA3E51F138AB4CEBEull,
+    0x93BA47C980E98CDFull, 0xC66F336C36B10137ull,
+    0xB8A8D9BBE123F017ull, 0xB80B0047445D4184ull,
+    0xE6D3102AD96CEC1Dull, 0xA60DC059157491E5ull,
+    0x9043EA1AC7E41392ull, 0x87C89837AD68DB2Full,
+    0xB454E4A179DD1877ull, 0x29BABE4598C311FBull,
+    0xE16A1DC9D8545E94ull, 0xF4296DD6FEF3D67Aull,
+    0x8CE2529E2734BB1Dull, 0x1899E4A65F58660Cull,
+    0xB01AE745B101E9E4ull, 0x5EC05DCFF72E7F8Full,
+    0xDC21A1171D42645Dull, 0x76707543F4FA1F73ull,
+    0x899504AE72497EBAull, 0x6A06494A791C53A8ull,
+    0xABFA45DA0EDBDE69ull, 0x0487DB9D17636892ull,
+    0xD6F8D7509292D603ull, 0x45A9D2845D3C42B6ull,
+    0x865B86925B9BC5C2ull, 0x0B8A2392BA45A9B2ull,
+    0xA7F26836F282B732ull, 0x8E6CAC7768D7141Eull,
+    0xD1EF0244AF2364FFull, 0x3207D795430CD926ull,
+    0x8335616AED761F1Full, 0x7F44E6BD49E807B8ull,
+    0xA402B9C5A8D3A6E7ull, 0x5F16206C9C6209A6ull,
+    0xCD036837130890A1ull, 0x36DBA887C37A8C0Full,
+    0x802221226BE55A64ull, 0xC2494954DA2C9789ull,
+    0xA02AA96B06DEB0FDull, 0xF2DB9BAA10B7BD6Cull,
+    0xC83553C5C8965D3Dull, 0x6F92829494E5ACC7ull,
+    0xFA42A8B73ABBF48Cull, 0xCB772339BA1F17F9ull,
+    0x9C69A97284B578D7ull, 0xFF2A760414536EFBull,
+    0xC38413CF25E2D70Dull, 0xFEF5138519684ABAull,
+    0xF46518C2EF5B8CD1ull, 0x7EB258665FC25D69ull,
+    0x98BF2F79D5993802ull, 0xEF2F773FFBD97A61ull,
+    0xBEEEFB584AFF8603ull, 0xAAFB550FFACFD8FAull,
+    0xEEAABA2E5DBF6784ull, 0x95BA2A53F983CF38ull,
+    0x952AB45CFA97A0B2ull, 0xDD945A747BF26183ull,
+    0xBA756174393D88DFull, 0x94F971119AEEF9E4ull,
+    0xE912B9D1478CEB17ull, 0x7A37CD5601AAB85Dull,
+    0x91ABB422CCB812EEull, 0xAC62E055C10AB33Aull,
+    0xB616A12B7FE617AAull, 0x577B986B314D6009ull,
+    0xE39C49765FDF9D94ull, 0xED5A7E85FDA0B80Bull,
+    0x8E41ADE9FBEBC27Dull, 0x14588F13BE847307ull,
+    0xB1D219647AE6B31Cull, 0x596EB2D8AE258FC8ull,
+    0xDE469FBD99A05FE3ull, 0x6FCA5F8ED9AEF3BBull,
+    0x8AEC23D680043BEEull, 0x25DE7BB9480D5854ull,
+    0xADA72CCC20054AE9ull, 0xAF561AA79A10AE6Aull,
+    0xD910F7FF28069DA4ull, 0x1B2BA1518094DA04ull,
+    0x87AA9AFF79042286ull, 0x90FB44D2F05D0842ull,
+    0xA99541BF57452B28ull, 0x353A1607AC744A53ull,
+    0xD3FA922F2D1675F2ull, 0x42889B8997915CE8ull,
+    0x847C9B5D7C2E09B7ull, 0x69956135FEBADA11ull,
+    0xA59BC234DB398C25ull, 0x43FAB9837E699095ull,
+    0xCF02B2C21207EF2Eull, 0x94F967E45E03F4BBull,
+    0x8161AFB94B44F57Dull, 0x1D1BE0EEBAC278F5ull,
+    0xA1BA1BA79E1632DCull, 0x6462D92A69731732ull,
+    0xCA28A291859BBF93ull, 0x7D7B8F7503CFDCFEull,
+    0xFCB2CB35E702AF78ull, 0x5CDA735244C3D43Eull,
+    0x9DEFBF01B061ADABull, 0x3A0888136AFA64A7ull,
+    0xC56BAEC21C7A1916ull, 0x088AAA1845B8FDD0ull,
+    0xF6C69A72A3989F5Bull, 0x8AAD549E57273D45ull,
+    0x9A3C2087A63F6399ull, 0x36AC54E2F678864Bull,
+    0xC0CB28A98FCF3C7Full, 0x84576A1BB416A7DDull,
+    0xF0FDF2D3F3C30B9Full, 0x656D44A2A11C51D5ull,
+    0x969EB7C47859E743ull, 0x9F644AE5A4B1B325ull,
+    0xBC4665B596706114ull, 0x873D5D9F0DDE1FEEull,
+    0xEB57FF22FC0C7959ull, 0xA90CB506D155A7EAull,
+    0x9316FF75DD87CBD8ull, 0x09A7F12442D588F2ull,
+    0xB7DCBF5354E9BECEull, 0x0C11ED6D538AEB2Full,
+    0xE5D3EF282A242E81ull, 0x8F1668C8A86DA5FAull,
+    0x8FA475791A569D10ull, 0xF96E017D694487BCull,
+    0xB38D92D760EC4455ull, 0x37C981DCC395A9ACull,
+    0xE070F78D3927556Aull, 0x85BBE253F47B1417ull,
+    0x8C469AB843B89562ull, 0x93956D7478CCEC8Eull,
+    0xAF58416654A6BABBull, 0x387AC8D1970027B2ull,
+    0xDB2E51BFE9D0696Aull, 0x06997B05FCC0319Eull,
+    0x88FCF317F22241E2ull, 0x441FECE3BDF81F03ull,
+    0xAB3C2FDDEEAAD25Aull, 0xD527E81CAD7626C3ull,
+    0xD60B3BD56A5586F1ull, 0x8A71E223D8D3B074ull,
+    0x85C7056562757456ull, 0xF6872D5667844E49ull,
+    0xA738C6BEBB12D16Cull, 0xB428F8AC016561DBull,
+    0xD106F86E69D785C7ull, 0xE13336D701BEBA52ull,
+    0x82A45B450226B39Cull, 0xECC0024661173473ull,
+    0xA34D721642B06084ull, 0x27F002D7F95D0190ull,
+    0xCC20CE9BD35C78A5ull, 0x31EC038DF7B441F4ull,
+    0xFF290242C83396CEull, 0x7E67047175A15271ull,
+    0x9F79A169BD203E41ull, 0x0F0062C6E984D386ull,
+    0xC75809C42C684DD1ull, 0x52C07B78A3E60868ull,
+    0xF92E0C3537826145ull, 0xA7709A56CCDF8A82ull,
+    0x9BBCC7A142B17CCBull, 0x88A66076400BB691ull,
+    0xC2ABF989935DDBFEull, 0x6ACFF893D00EA435ull,
+    0xF356F7EBF83552FEull, 0x0583F6B8C4124D43ull,
+    0x98165AF37B2153DEull, 0xC3727A337A8B704Aull,
+    0xBE1BF1B059E9A8D6ull, 0x744F18C0592E4C5Cull,
+    0xEDA2EE1C7064130Cull, 0x1162DEF06F79DF73ull,
+    0x9485D4D1C63E8BE7ull, 0x8ADDCB5645AC2BA8ull,
+    0xB9A74A0637CE2EE1ull, 0x6D953E2BD7173692ull,
+    0xE8111C87C5C1BA99ull, 0xC8FA8DB6CCDD0437ull,
+    0x910AB1D4DB9914A0ull, 0x1D9C9892400A22A2ull,
+    0xB54D5E4A127F59C8ull, 0x2503BEB6D00CAB4Bull,
+    0xE2A0B5DC971F303Aull, 0x2E44AE64840FD61Dull,
+    0x8DA471A9DE737E24ull, 0x5CEAECFED289E5D2ull,
+    0xB10D8E1456105DADull, 0x7425A83E872C5F47ull,
+    0xDD50F1996B947518ull, 0xD12F124E28F77719ull,
+    0x8A5296FFE33CC92Full, 0x82BD6B70D99AAA6Full,
+    0xACE73CBFDC0BFB7Bull, 0x636CC64D1001550Bull,
+    0xD8210BEFD30EFA5Aull, 0x3C47F7E05401AA4Eull,
+    0x8714A775E3E95C78ull, 0x65ACFAEC34810A71ull,
+    0xA8D9D1535CE3B396ull, 0x7F1839A741A14D0Dull,
+    0xD31045A8341CA07Cull, 0x1EDE48111209A050ull,
+    0x83EA2B892091E44Dull, 0x934AED0AAB460432ull,
+    0xA4E4B66B68B65D60ull, 0xF81DA84D5617853Full,
+    0xCE1DE40642E3F4B9ull, 0x36251260AB9D668Eull,
+    0x80D2AE83E9CE78F3ull, 0xC1D72B7C6B426019ull,
+    0xA1075A24E4421730ull, 0xB24CF65B8612F81Full,
+    0xC94930AE1D529CFCull, 0xDEE033F26797B627ull,
+    0xFB9B7CD9A4A7443Cull, 0x169840EF017DA3B1ull,
+    0x9D412E0806E88AA5ull, 0x8E1F289560EE864Eull,
+    0xC491798A08A2AD4Eull, 0xF1A6F2BAB92A27E2ull,
+    0xF5B5D7EC8ACB58A2ull, 0xAE10AF696774B1DBull,
+    0x9991A6F3D6BF1765ull, 0xACCA6DA1E0A8EF29ull,
+    0xBFF610B0CC6EDD3Full, 0x17FD090A58D32AF3ull,
+    0xEFF394DCFF8A948Eull, 0xDDFC4B4CEF07F5B0ull,
+    0x95F83D0A1FB69CD9ull, 0x4ABDAF101564F98Eull,
+    0xBB764C4CA7A4440Full, 0x9D6D1AD41ABE37F1ull,
+    0xEA53DF5FD18D5513ull, 0x84C86189216DC5EDull,
+    0x92746B9BE2F8552Cull, 0x32FD3CF5B4E49BB4ull,
+    0xB7118682DBB66A77ull, 0x3FBC8C33221DC2A1ull,
+    0xE4D5E82392A40515ull, 0x0FABAF3FEAA5334Aull,
+    0x8F05B1163BA6832Dull, 0x29CB4D87F2A7400Eull,
+    0xB2C71D5BCA9023F8ull, 0x743E20E9EF511012ull,
+    0xDF78E4B2BD342CF6ull, 0x914DA9246B255416ull,
+    0x8BAB8EEFB6409C1Aull, 0x1AD089B6C2F7548Eull,
+    0xAE9672ABA3D0C320ull, 0xA184AC2473B529B1ull,
+    0xDA3C0F568CC4F3E8ull, 0xC9E5D72D90A2741Eull,
+    0x8865899617FB1871ull, 0x7E2FA67C7A658892ull,
+    0xAA7EEBFB9DF9DE8Dull, 0xDDBB901B98FEEAB7ull,
+    0xD51EA6FA85785631ull, 0x552A74227F3EA565ull,
+    0x8533285C936B35DEull, 0xD53A88958F87275Full,
+    0xA67FF273B8460356ull, 0x8A892ABAF368F137ull,
+    0xD01FEF10A657842Cull, 0x2D2B7569B0432D85ull,
+    0x8213F56A67F6B29Bull, 0x9C3B29620E29FC73ull,
+    0xA298F2C501F45F42ull, 0x8349F3BA91B47B8Full,
+    0xCB3F2F7642717713ull, 0x241C70A936219A73ull,
+    0xFE0EFB53D30DD4D7ull, 0xED238CD383AA0110ull,
+    0x9EC95D1463E8A506ull, 0xF4363804324A40AAull,
+    0xC67BB4597CE2CE48ull, 0xB143C6053EDCD0D5ull,
+    0xF81AA16FDC1B81DAull, 0xDD94B7868E94050Aull,
+    0x9B10A4E5E9913128ull, 0xCA7CF2B4191C8326ull,
+    0xC1D4CE1F63F57D72ull, 0xFD1C2F611F63A3F0ull,
+    0xF24A01A73CF2DCCFull, 0xBC633B39673C8CECull,
+    0x976E41088617CA01ull, 0xD5BE0503E085D813ull,
+    0xBD49D14AA79DBC82ull, 0x4B2D8644D8A74E18ull,
+    0xEC9C459D51852BA2ull, 0xDDF8E7D60ED1219Eull,
+    0x93E1AB8252F33B45ull, 0xCABB90E5C942B503ull,
+    0xB8DA1662E7B00A17ull, 0x3D6A751F3B936243ull,
+    0xE7109BFBA19C0C9Dull, 0x0CC512670A783AD4ull,
+    0x906A617D450187E2ull, 0x27FB2B80668B24C5ull,
+    0xB484F9DC9641E9DAull, 0xB1F9F660802DEDF6ull,
+    0xE1A63853BBD26451ull, 0x5E7873F8A0396973ull,
+    0x8D07E33455637EB2ull, 0xDB0B487B6423E1E8ull,
+    0xB049DC016ABC5E5Full, 0x91CE1A9A3D2CDA62ull,
+    0xDC5C5301C56B75F7ull, 0x7641A140CC7810FBull,
+    0x89B9B3E11B6329BAull, 0xA9E904C87FCB0A9Dull,
+    0xAC2820D9623BF429ull, 0x546345FA9FBDCD44ull,
+    0xD732290FBACAF133ull, 0xA97C177947AD4095ull,
+    0x867F59A9D4BED6C0ull, 0x49ED8EABCCCC485Dull,
+    0xA81F301449EE8C70ull, 0x5C68F256BFFF5A74ull,
+    0xD226FC195C6A2F8Cull, 0x73832EEC6FFF3111ull,
+    0x83585D8FD9C25DB7ull, 0xC831FD53C5FF7EABull,
+    0xA42E74F3D032F525ull, 0xBA3E7CA8B77F5E55ull,
+    0xCD3A1230C43FB26Full, 0x28CE1BD2E55F35EBull,
+    0x80444B5E7AA7CF85ull, 0x7980D163CF5B81B3ull,
+    0xA0555E361951C366ull, 0xD7E105BCC332621Full,
+    0xC86AB5C39FA63440ull, 0x8DD9472BF3FEFAA7ull,
+    0xFA856334878FC150ull, 0xB14F98F6F0FEB951ull,
+    0x9C935E00D4B9D8D2ull, 0x6ED1BF9A569F33D3ull,
+    0xC3B8358109E84F07ull, 0x0A862F80EC4700C8ull,
+    0xF4A642E14C6262C8ull, 0xCD27BB612758C0FAull,
+    0x98E7E9CCCFBD7DBDull, 0x8038D51CB897789Cull,
+    0xBF21E44003ACDD2Cull, 0xE0470A63E6BD56C3ull,
+    0xEEEA5D5004981478ull, 0x1858CCFCE06CAC74ull,
+    0x95527A5202DF0CCBull, 0x0F37801E0C43EBC8ull,
+    0xBAA718E68396CFFDull, 0xD30560258F54E6BAull,
+    0xE950DF20247C83FDull, 0x47C6B82EF32A2069ull,
+    0x91D28B7416CDD27Eull, 0x4CDC331D57FA5441ull,
+    0xB6472E511C81471Dull, 0xE0133FE4ADF8E952ull,
+    0xE3D8F9E563A198E5ull, 0x58180FDDD97723A6ull,
+    0x8E679C2F5E44FF8Full, 0x570F09EAA7EA7648ull
+};
+
+static const double G_AK_Json__Exact_Powers_Of_Ten[] = 
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11, 
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+typedef struct ak_json__decimal
+{
+    const ak_json_u8* Integer;
+    ak_json_u64       IntegerLength;
+    const ak_json_u8* Fraction;
+    ak_json_u64       FractionLength;
+    long long         Exponent;
+    int               Negative;
+} ak_json__decimal;
+
+typedef struct ak_json__float_bits
+{
+    ak_json_u64 Mantissa;
+    int         Power2;
+} ak_json__float_bits;
+
+typedef struct ak_json__big_int
+{
+    ak_json_u32  Limbs[AK_JSON__BIG_INT_LIMB_COUNT];
+    unsigned int Count;
+} ak_json__big_int;
+
+static unsigned int AK_Json__Count_Leading_Zeros(ak_json_u64 Value)
+{
+    AK_JSON_ASSERT(Value);
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_clzll(Value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long Result;
+    _BitScanReverse64(&Result, Value);
+    return 63 - (unsigned int)Result;
+#else
+    unsigned int Result = 0;
+    while(!(Value & 0x8000000000000000ull))
+    {
+        Value <<= 1;
+        Result++;
+    }
+    return Result;
+#endif
+}
+
+static ak_json_u64 AK_Json__Multiply_U64(ak_json_u64 A, ak_json_u64 B, ak_json_u64* High)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 Result = (unsigned __int128)A*B;
+    *High = (ak_json_u64)(Result >> 64);
+    return (ak_json_u64)Result;
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(A, B, High);
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+    *High = __umulh(A, B);
+    return A*B;
+#else
+    ak_json_u64 LowLow   = (A & 0xFFFFFFFF)*(B & 0xFFFFFFFF);
+    ak_json_u64 HighLow  = (A >> 32)*(B & 0xFFFFFFFF);
+    ak_json_u64 LowHigh  = (A & 0xFFFFFFFF)*(B >> 32);
+    ak_json_u64 HighHigh = (A >> 32)*(B >> 32);
+    ak_json_u64 Cross    = (LowLow >> 32) + (HighLow & 0xFFFFFFFF) + LowHigh;
+    *High = HighHigh + (HighLow >> 32) + (Cross >> 32);
+    return (Cross << 32) | (LowLow & 0xFFFFFFFF);
+#endif
+}
+
+//NOTE(EVERYONE): Turns 8 ascii digits loaded little endian into their value with three multiplies
+static ak_json_u32 AK_Json__Parse_Eight_Digits(ak_json_u64 Word)
+{
+    Word -= 0x3030303030303030ull;
+    Word = (Word*10) + (Word >> 8);
+    Word = (((Word & 0x000000FF000000FFull)*0x000F424000000064ull) + 
+            (((Word >> 16) & 0x000000FF000000FFull)*0x0000271000000001ull)) >> 32;
+    return (ak_json_u32)Word;
+}
+
+static ak_json_u64 AK_Json__Accumulate_Digits(ak_json_u64 Mantissa, const ak_json_u8* Digits, ak_json_u64 Count)
+{
+    ak_json_u64 Index = 0;
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for(; Index+8 <= Count; Index += 8)
+        Mantissa = Mantissa*100000000 + AK_Json__Parse_Eight_Digits(AK_Json__Load_U64(Digits+Index));
+#endif
+    for(; Index < Count; Index++)
+        Mantissa = Mantissa*10 + (ak_json_u64)(Digits[Index]-'0');
+    return Mantissa;
+}
+
+static void AK_Json__Decimal_Parse(ak_json__decimal* Decimal, ak_json_str Str)
+{
+    const ak_json_u8* At  = Str.Str;
+    const ak_json_u8* End = Str.Str+Str.Length;
+    
+    Decimal->Negative = At < End && *At == '-';
+    if(Decimal->Negative) At++;
+    
+    Decimal->Integer = At;
+    while(At < End && AK_Json__Is_Digit(*At)) At++;
+    Decimal->IntegerLength = (ak_json_u64)(At-Decimal->Integer);
+    
+    Decimal->Fraction = At;
+    Decimal->FractionLength = 0;
+    if(At < End && *At == '.')
+    {
+        Decimal->Fraction = ++At;
+        while(At < End && AK_Json__Is_Digit(*At)) At++;
+        Decimal->FractionLength = (ak_json_u64)(At-Decimal->Fraction);
+    }
+    
+    Decimal->Exponent = 0;
+    if(At < End && (*At == 'e' || *At == 'E'))
+    {
+        At++;
+        int IsNegative = At < End && *At == '-';
+        if(At < End && (*At == '-' || *At == '+')) At++;
         
-        case 't':
-        case 'f':
+        //NOTE(EVERYONE): Saturate, anything this large is already zero or infinity
+        while(At < End && AK_Json__Is_Digit(*At))
         {
-            Result = AK_Json__Tokenize_Boolean(Tokenizer, Stream);
-            if(!Result)
-            {
-                AK_Json__Error_Log(Tokenizer->ErrorArena, Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting boolean value. Got undefined."));
-            }
-        } break;
+            if(Decimal->Exponent < 0x10000000) Decimal->Exponent = Decimal->Exponent*10 + (*At-'0');
+            At++;
+        }
+        if(IsNegative) Decimal->Exponent = -Decimal->Exponent;
+    }
+}
+
+//NOTE(EVERYONE): Digits are indexed as if the integer and fraction parts were one string without the '.'
+static ak_json_u8 AK_Json__Decimal_Get_Digit(const ak_json__decimal* Decimal, ak_json_u64 Index)
+{
+    return Index < Decimal->IntegerLength ? Decimal->Integer[Index] : Decimal->Fraction[Index-Decimal->IntegerLength];
+}
+
+static ak_json_u64 AK_Json__Decimal_Accumulate(const ak_json__decimal* Decimal, ak_json_u64 Mantissa, ak_json_u64 From, ak_json_u64 To)
+{
+    if(From < Decimal->IntegerLength)
+    {
+        ak_json_u64 IntegerTo = To < Decimal->IntegerLength ? To : Decimal->IntegerLength;
+        Mantissa = AK_Json__Accumulate_Digits(Mantissa, Decimal->Integer+From, IntegerTo-From);
+        From = IntegerTo;
+    }
+    
+    if(From < To) 
+        Mantissa = AK_Json__Accumulate_Digits(Mantissa, Decimal->Fraction+(From-Decimal->IntegerLength), To-From);
+    return Mantissa;
+}
+
+static double AK_Json__Float_Bits_To_Double(ak_json__float_bits Bits, int Negative)
+{
+    ak_json_u64 Word = Bits.Mantissa | ((ak_json_u64)Bits.Power2 << AK_JSON__DOUBLE_MANTISSA_BITS) | ((ak_json_u64)(Negative != 0) << 63);
+    double Result;
+    AK_Json__Memory_Copy(&Result, &Word, sizeof(double));
+    return Result;
+}
+
+//NOTE(EVERYONE): Computes Mantissa*10^Exponent10 rounded to nearest even. Power2 is the biased exponent and 
+//Mantissa has the implicit bit removed, except for the subnormal that rounds up to the smallest normal which 
+//keeps it and reports Power2 = 1 so the bits still compose correctly
+static ak_json__float_bits AK_Json__Eisel_Lemire(long long Exponent10, ak_json_u64 Mantissa)
+{
+    ak_json__float_bits Result;
+    Result.Mantissa = 0;
+    Result.Power2   = 0;
+    if(!Mantissa || Exponent10 < AK_JSON__MIN_POWER_OF_TEN) return Result;
+    if(Exponent10 > AK_JSON__MAX_POWER_OF_TEN)
+    {
+        Result.Power2 = AK_JSON__DOUBLE_INFINITE_POWER;
+        return Result;
+    }
+    
+    int Exponent = (int)Exponent10;
+    unsigned int LeadingZeros = AK_Json__Count_Leading_Zeros(Mantissa);
+    Mantissa <<= LeadingZeros;
+    
+    //NOTE(EVERYONE): The second half of the power is only needed when the bits below the 55 we keep are all 
+    //ones, otherwise a carry from it can't reach them
+    const ak_json_u64* Power = G_AK_Json__Powers_Of_Five + 2*(Exponent-AK_JSON__MIN_POWER_OF_TEN);
+    ak_json_u64 High;
+    ak_json_u64 Low = AK_Json__Multiply_U64(Mantissa, Power[0], &High);
+    if((High & 0x1FF) == 0x1FF)
+    {
+        ak_json_u64 SecondHigh;
+        AK_Json__Multiply_U64(Mantissa, Power[1], &SecondHigh);
+        Low += SecondHigh;
+        if(SecondHigh > Low) High++;
+    }
+    
+    int UpperBit = (int)(High >> 63);
+    int Shift = UpperBit + 64 - AK_JSON__DOUBLE_MANTISSA_BITS - 3;
+    Result.Mantissa = High >> Shift;
+    
+    //NOTE(EVERYONE): floor(log2(10^q)) is ((152170+65536)*q) >> 16 for the whole table range
+    Result.Power2 = (((152170+65536)*Exponent) >> 16) + 63 + UpperBit - (int)LeadingZeros + 1023;
+    if(Result.Power2 <= 0)
+    {
+        if(-Result.Power2+1 >= 64)
+        {
+            Result.Mantissa = 0;
+            Result.Power2   = 0;
+            return Result;
+        }
         
-        case '"':
+        Result.Mantissa >>= -Result.Power2+1;
+        Result.Mantissa += Result.Mantissa & 1;
+        Result.Mantissa >>= 1;
+        Result.Power2 = Result.Mantissa < (1ull << AK_JSON__DOUBLE_MANTISSA_BITS) ? 0 : 1;
+        return Result;
+    }
+    
+    //NOTE(EVERYONE): Only powers of ten in [-4, 23] can land exactly between two doubles
+    if(Low <= 1 && Exponent >= -4 && Exponent <= 23 && (Result.Mantissa & 3) == 1)
+    {
+        if((Result.Mantissa << Shift) == High)
+            Result.Mantissa &= ~1ull;
+    }
+    
+    Result.Mantissa += Result.Mantissa & 1;
+    Result.Mantissa >>= 1;
+    if(Result.Mantissa >= (2ull << AK_JSON__DOUBLE_MANTISSA_BITS))
+    {
+        Result.Mantissa = 1ull << AK_JSON__DOUBLE_MANTISSA_BITS;
+        Result.Power2++;
+    }
+    Result.Mantissa &= ~(1ull << AK_JSON__DOUBLE_MANTISSA_BITS);
+    
+    if(Result.Power2 >= AK_JSON__DOUBLE_INFINITE_POWER)
+    {
+        Result.Mantissa = 0;
+        Result.Power2   = AK_JSON__DOUBLE_INFINITE_POWER;
+    }
+    return Result;
+}
+
+static void AK_Json__Big_Int_Multiply_Add(ak_json__big_int* BigInt, ak_json_u32 Multiplier, ak_json_u32 Addend)
+{
+    ak_json_u64 Carry = Addend;
+    unsigned int Index;
+    for(Index = 0; Index < BigInt->Count; Index++)
+    {
+        ak_json_u64 Product = (ak_json_u64)BigInt->Limbs[Index]*Multiplier + Carry;
+        BigInt->Limbs[Index] = (ak_json_u32)Product;
+        Carry = Product >> 32;
+    }
+    
+    if(Carry)
+    {
+        AK_JSON_ASSERT(BigInt->Count < AK_JSON__BIG_INT_LIMB_COUNT);
+        BigInt->Limbs[BigInt->Count++] = (ak_json_u32)Carry;
+    }
+}
+
+static void AK_Json__Big_Int_Multiply_Power_Of_Five(ak_json__big_int* BigInt, ak_json_u64 Exponent)
+{
+    //NOTE(EVERYONE): 5^13 is the largest power of five that fits in 32 bits
+    for(; Exponent >= 13; Exponent -= 13)
+        AK_Json__Big_Int_Multiply_Add(BigInt, 1220703125, 0);
+    
+    ak_json_u32 Multiplier = 1;
+    for(; Exponent; Exponent--) Multiplier *= 5;
+    AK_Json__Big_Int_Multiply_Add(BigInt, Multiplier, 0);
+}
+
+static void AK_Json__Big_Int_Shift_Left(ak_json__big_int* BigInt, ak_json_u64 Shift)
+{
+    if(!BigInt->Count) return;
+    
+    unsigned int BitShift = (unsigned int)(Shift % 32);
+    if(BitShift)
+    {
+        ak_json_u32 Carry = 0;
+        unsigned int Index;
+        for(Index = 0; Index < BigInt->Count; Index++)
         {
-            Result = AK_Json__Tokenize_String(Tokenizer, Stream);
-            if(!Result)
-            {
-                AK_Json__Error_Log(Tokenizer->ErrorArena, Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting string value. Got undefined."));
-            }
-        } break;
+            ak_json_u32 Limb = BigInt->Limbs[Index];
+            BigInt->Limbs[Index] = (Limb << BitShift) | Carry;
+            Carry = Limb >> (32-BitShift);
+        }
         
-        default:
+        if(Carry)
         {
-            Result = AK_Json__Tokenize_Number(Tokenizer, Stream);
-            if(!Result)
-            {
-                AK_Json__Error_Log(Tokenizer->ErrorArena, Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting numeric value. Got undefined."));
-            }
-        } break;
+            AK_JSON_ASSERT(BigInt->Count < AK_JSON__BIG_INT_LIMB_COUNT);
+            BigInt->Limbs[BigInt->Count++] = Carry;
+        }
+    }
+    
+    unsigned int LimbShift = (unsigned int)(Shift / 32);
+    if(LimbShift)
+    {
+        AK_JSON_ASSERT(BigInt->Count+LimbShift <= AK_JSON__BIG_INT_LIMB_COUNT);
+        unsigned int Index;
+        for(Index = BigInt->Count; Index--;)
+            BigInt->Limbs[Index+LimbShift] = BigInt->Limbs[Index];
+        for(Index = 0; Index < LimbShift; Index++)
+            BigInt->Limbs[Index] = 0;
+        BigInt->Count += LimbShift;
+    }
+}
+
+static int AK_Json__Big_Int_Compare(const ak_json__big_int* A, const ak_json__big_int* B)
+{
+    if(A->Count != B->Count) return A->Count > B->Count ? 1 : -1;
+    
+    unsigned int Index;
+    for(Index = A->Count; Index--;)
+    {
+        if(A->Limbs[Index] != B->Limbs[Index])
+            return A->Limbs[Index] > B->Limbs[Index] ? 1 : -1;
+    }
+    return 0;
+}
+
+//NOTE(EVERYONE): Slow path for long inputs whose first 19 digits round to Lower or to the next double up. 
+//The decimal D*10^E is compared exactly with the halfway point H*2^P between the two by scaling both to 
+//integers. Any decimal with more than 768 significant digits can't be closer to a halfway point than its 
+//first 768 digits are, so the rest only count for whether they are nonzero
+static ak_json__float_bits AK_Json__Decimal_Round(const ak_json__decimal* Decimal, ak_json_u64 Start, ak_json__float_bits Lower)
+{
+    ak_json_u64 Total = Decimal->IntegerLength+Decimal->FractionLength;
+    ak_json_u64 Count = Total-Start;
+    if(Count > AK_JSON__MAX_DECIMAL_DIGITS) Count = AK_JSON__MAX_DECIMAL_DIGITS;
+    
+    int HasMoreDigits = 0;
+    ak_json_u64 Index;
+    for(Index = Start+Count; Index < Total && !HasMoreDigits; Index++)
+        HasMoreDigits = AK_Json__Decimal_Get_Digit(Decimal, Index) != '0';
+    
+    ak_json__big_int Digits;
+    Digits.Count = 0;
+    for(Index = Start; Index < Start+Count;)
+    {
+        ak_json_u32 Chunk = 0;
+        ak_json_u32 Multiplier = 1;
+        for(; Index < Start+Count && Multiplier < 1000000000; Index++)
+        {
+            Chunk = Chunk*10 + (ak_json_u32)(AK_Json__Decimal_Get_Digit(Decimal, Index)-'0');
+            Multiplier *= 10;
+        }
+        AK_Json__Big_Int_Multiply_Add(&Digits, Multiplier, Chunk);
     }
+    long long Exponent10 = Decimal->Exponent + (long long)Decimal->IntegerLength - (long long)(Start+Count);
+    
+    ak_json_u64 HalfwayMantissa = Lower.Mantissa | (Lower.Power2 ? (1ull << AK_JSON__DOUBLE_MANTISSA_BITS) : 0);
+    HalfwayMantissa = 2*HalfwayMantissa + 1;
+    long long Exponent2 = (long long)(Lower.Power2 ? Lower.Power2 : 1) - 1075 - 1;
+    
+    ak_json__big_int Halfway;
+    Halfway.Limbs[0] = (ak_json_u32)HalfwayMantissa;
+    Halfway.Limbs[1] = (ak_json_u32)(HalfwayMantissa >> 32);
+    Halfway.Count = Halfway.Limbs[1] ? 2 : 1;
+    
+    if(Exponent10 >= 0) AK_Json__Big_Int_Multiply_Power_Of_Five(&Digits, (ak_json_u64)Exponent10);
+    else AK_Json__Big_Int_Multiply_Power_Of_Five(&Halfway, (ak_json_u64)-Exponent10);
+    
+    if(Exponent10 > Exponent2) AK_Json__Big_Int_Shift_Left(&Digits, (ak_json_u64)(Exponent10-Exponent2));
+    else AK_Json__Big_Int_Shift_Left(&Halfway, (ak_json_u64)(Exponent2-Exponent10));
+    
+    int Order = AK_Json__Big_Int_Compare(&Digits, &Halfway);
+    if(!Order && HasMoreDigits) Order = 1;
+    if(Order > 0 || (!Order && (Lower.Mantissa & 1)))
+    {
+        ak_json_u64 Word = (Lower.Mantissa | ((ak_json_u64)Lower.Power2 << AK_JSON__DOUBLE_MANTISSA_BITS)) + 1;
+        Lower.Mantissa = Word & ((1ull << AK_JSON__DOUBLE_MANTISSA_BITS)-1);
+        Lower.Power2   = (int)(Word >> AK_JSON__DOUBLE_MANTISSA_BITS);
+    }
+    return Lower;
+}
+
+//NOTE(EVERYONE): Str must be a number token that already passed the scanner
+static double AK_Json__Json_Str_To_Number(ak_json_str Str)
+{
+    ak_json__decimal Decimal;
+    AK_Json__Decimal_Parse(&Decimal, Str);
+    
+    ak_json_u64 Total = Decimal.IntegerLength+Decimal.FractionLength;
+    ak_json_u64 Start = 0;
+    while(Start < Total && AK_Json__Decimal_Get_Digit(&Decimal, Start) == '0') Start++;
+    
+    ak_json_u64 Count = Total-Start;
+    if(Count > AK_JSON__MAX_MANTISSA_DIGITS) Count = AK_JSON__MAX_MANTISSA_DIGITS;
+    
+    int IsTruncated = 0;
+    ak_json_u64 Index;
+    for(Index = Start+Count; Index < Total && !IsTruncated; Index++)
+        IsTruncated = AK_Json__Decimal_Get_Digit(&Decimal, Index) != '0';
+    
+    ak_json_u64 Mantissa = AK_Json__Decimal_Accumulate(&Decimal, 0, Start, Start+Count);
+    long long Exponent10 = Decimal.Exponent + (long long)Decimal.IntegerLength - (long long)(Start+Count);
+    
+    //NOTE(EVERYONE): Clinger's fast path. Both operands are exact so the one IEEE operation rounds correctly. 
+    //x87 without SSE2 evaluates in extended precision and would round twice, so it is skipped there
+#if !((defined(__i386__) || defined(_M_IX86)) && !defined(__SSE2_MATH__) && !(defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    if(!IsTruncated && Exponent10 >= -22 && Exponent10 <= 22 && Mantissa <= (1ull << 53))
+    {
+        double Result = (double)Mantissa;
+        if(Exponent10 < 0) Result /= G_AK_Json__Exact_Powers_Of_Ten[-Exponent10];
+        else Result *= G_AK_Json__Exact_Powers_Of_Ten[Exponent10];
+        return Decimal.Negative ? -Result : Result;
+    }
+#endif
+    
+    ak_json__float_bits Bits = AK_Json__Eisel_Lemire(Exponent10, Mantissa);
+    if(IsTruncated)
+    {
+        ak_json__float_bits Upper = AK_Json__Eisel_Lemire(Exponent10, Mantissa+1);
+        if(Bits.Mantissa != Upper.Mantissa || Bits.Power2 != Upper.Power2)
+            Bits = AK_Json__Decimal_Round(&Decimal, Start, Bits);
+    }
+    
+    return AK_Json__Float_Bits_To_Double(Bits, Decimal.Negative);
+}
+
+typedef enum ak_json__number_type
+{
+    AK_JSON__NUMBER_TYPE_FLOAT,
+    AK_JSON__NUMBER_TYPE_INT64,
+    AK_JSON__NUMBER_TYPE_UINT64
+} ak_json__number_type;
+
+//NOTE(EVERYONE): UINT64 is only used for values above the int64 range
+typedef struct ak_json__number
+{
+    ak_json__number_type Type;
+    union
+    {
+        double      Float;
+        ak_json_s64 Int64;
+        ak_json_u64 Uint64;
+    };
+} ak_json__number;
+
+//NOTE(EVERYONE): Integer tokens never touch the float code. Anything with a fraction or exponent, outside of 
+//the 64 bit range, or -0 (whose sign only a double keeps) returns 0 and is parsed as a double instead
+static int AK_Json__Json_Str_To_Integer(ak_json_str Str, ak_json__number* Number)
+{
+    const ak_json_u8* At  = Str.Str;
+    const ak_json_u8* End = Str.Str+Str.Length;
+    
+    int Negative = At < End && *At == '-';
+    if(Negative) At++;
+    
+    ak_json_u64 Length = (ak_json_u64)(End-At);
+    if(!Length || Length > 20) return 0;
+    
+    ak_json_u64 Value = 0;
+    for(; At < End; At++)
+    {
+        unsigned int Digit = (unsigned int)(*At-'0');
+        if(Digit > 9) return 0;
+        if(Length == 20 && Value > (0xFFFFFFFFFFFFFFFFull-Digit)/10) return 0;
+        Value = Value*10 + Digit;
+    }
+    
+    if(Negative)
+    {
+        if(!Value || Value > 0x8000000000000000ull) return 0;
+        Number->Type  = AK_JSON__NUMBER_TYPE_INT64;
+        Number->Int64 = -(ak_json_s64)(Value-1) - 1;
+    }
+    else if(Value > 0x7FFFFFFFFFFFFFFFull)
+    {
+        Number->Type   = AK_JSON__NUMBER_TYPE_UINT64;
+        Number->Uint64 = Value;
+    }
+    else
+    {
+        Number->Type  = AK_JSON__NUMBER_TYPE_INT64;
+        Number->Int64 = (ak_json_s64)Value;
+    }
+    return 1;
+}
+
+/*************
+*** Values ***
+**************/
+
+//NOTE(EVERYONE): Every value is a 16 byte node. The low byte of Tag is the value type and the rest is a 
+//payload whose meaning depends on it: the boolean, the number type, the string length or the child count. 
+//The second word is the number itself, the string bytes or the contiguous block of children. Arrays and 
+//objects are not separate structs, they are the same node looked at through a different type
+#define AK_JSON__VALUE_TYPE_MASK     0xFF
+#define AK_JSON__VALUE_PAYLOAD_SHIFT 8
+
+typedef struct ak_json_value
+{
+    ak_json_u64 Tag;
+    union
+    {
+        double                Float;
+        ak_json_s64           Int64;
+        ak_json_u64           Uint64;
+        const ak_json_u8*     String;
+        struct ak_json_value* Values;
+        struct ak_json_key*   Keys;
+    };
+} ak_json_value;
+
+typedef char ak_json__value_size_check[sizeof(ak_json_value) == 16 ? 1 : -1];
+
+typedef struct ak_json_array
+{
+    ak_json_u64           Tag;
+    struct ak_json_value* Values;
+} ak_json_array;
+
+typedef struct ak_json_object
+{
+    ak_json_u64         Tag;
+    struct ak_json_key* Keys;
+} ak_json_object;
+
+//NOTE(EVERYONE): Key names are always interned, so the name is only a pointer and its length lives in 
+//the interned key header
+typedef struct ak_json_key
+{
+    const ak_json_u8* Name;
+    ak_json_value     Value;
+} ak_json_key;
+
+static ak_json_u64 AK_Json__Tag(ak_json_value_type Type, ak_json_u64 Payload)
+{
+    return (ak_json_u64)Type | (Payload << AK_JSON__VALUE_PAYLOAD_SHIFT);
+}
+
+static ak_json_value_type AK_Json__Tag_Get_Type(ak_json_u64 Tag)
+{
+    return (ak_json_value_type)(Tag & AK_JSON__VALUE_TYPE_MASK);
+}
+
+static ak_json_u64 AK_Json__Tag_Get_Payload(ak_json_u64 Tag)
+{
+    return Tag >> AK_JSON__VALUE_PAYLOAD_SHIFT;
+}
+
+static unsigned int AK_Json__Object_Get_Count(ak_json_object* Object)
+{
+    return (unsigned int)AK_Json__Tag_Get_Payload(Object->Tag);
+}
+
+//NOTE(EVERYONE): Objects with at least this many keys get an open addressing hash index, smaller ones 
+//are searched linearly. The index is a power of two array of key indices plus one (zero is an empty slot), 
+//at most half full, and it is stored in the same block right after the keys
+#ifndef AK_JSON_OBJECT_HASH_MIN_KEYS
+#define AK_JSON_OBJECT_HASH_MIN_KEYS 16
+#endif
+
+static ak_json_u32 AK_Json__Object_Get_Slot_Count(unsigned int KeyCount)
+{
+    if(KeyCount < AK_JSON_OBJECT_HASH_MIN_KEYS) return 0;
+    
+    //NOTE(EVERYONE): The probes mask with SlotCount-1, so start from a power of two instead of the 
+    //threshold, which may be any number
+    ak_json_u32 SlotCount = 16;
+    while(SlotCount < KeyCount*2) SlotCount *= 2;
+    return SlotCount;
+}
+
+static ak_json_u32* AK_Json__Object_Get_Slots(ak_json_object* Object)
+{
+    return (ak_json_u32*)(Object->Keys+AK_Json__Object_Get_Count(Object));
+}
+
+static void AK_Json__Object_Build_Index(ak_json_object* Object)
+{
+    unsigned int Count = AK_Json__Object_Get_Count(Object);
+    ak_json_u32 SlotCount = AK_Json__Object_Get_Slot_Count(Count);
+    ak_json_u32* Slots = AK_Json__Object_Get_Slots(Object);
+    AK_Json__Memory_Clear(Slots, SlotCount*sizeof(ak_json_u32));
+    
+    unsigned int KeyIndex;
+    for(KeyIndex = 0; KeyIndex < Count; KeyIndex++)
+    {
+        const ak_json_u8* Name = Object->Keys[KeyIndex].Name;
+        ak_json_u32 SlotIndex = (ak_json_u32)AK_Json__Interned_Key_Get(Name)->Hash & (SlotCount-1);
+        
+        //NOTE(EVERYONE): On duplicate keys the first one wins, same as the linear search. Names are 
+        //interned so equal names are the same pointer
+        for(;;)
+        {
+            if(!Slots[SlotIndex])
+            {
+                Slots[SlotIndex] = KeyIndex+1;
+                break;
+            }
+            
+            if(Object->Keys[Slots[SlotIndex]-1].Name == Name) break;
+            SlotIndex = (SlotIndex+1) & (SlotCount-1);
+        }
+    }
+}
+
+//NOTE(EVERYONE): Values are built on a stack while parsing. When an array closes, its elements are on top 
+//of the stack and get copied into one contiguous block in the arena, so the children of a container always 
+//sit next to each other. Pointers into the stack are only valid until the next push
+typedef struct ak_json__value_stack
+{
+    ak_json_allocator Allocator;
+    ak_json_value*    Values;
+    ak_json_u64       Count;
+    ak_json_u64       Capacity;
+} ak_json__value_stack;
+
+static void AK_Json__Value_Stack_Create(ak_json__value_stack* Stack, ak_json_allocator Allocator)
+{
+    Stack->Allocator = Allocator;
+    Stack->Values    = NULL;
+    Stack->Count     = 0;
+    Stack->Capacity  = 0;
+}
+
+static void AK_Json__Value_Stack_Delete(ak_json__value_stack* Stack)
+{
+    AK_Json__Free(&Stack->Allocator, Stack->Values);
+    Stack->Values = NULL;
+    Stack->Count = Stack->Capacity = 0;
+}
+
+static int AK_Json__Value_Stack_Reserve(ak_json__value_stack* Stack, ak_json_u64 Capacity)
+{
+    if(Capacity <= Stack->Capacity) return 1;
+    
+    ak_json_value* Values = (ak_json_value*)AK_Json__Allocate(&Stack->Allocator, Capacity*sizeof(ak_json_value));
+    if(!Values) return 0;
+    
+    if(Stack->Values)
+    {
+        AK_Json__Memory_Copy(Values, Stack->Values, Stack->Count*sizeof(ak_json_value));
+        AK_Json__Free(&Stack->Allocator, Stack->Values);
+    }
+    
+    Stack->Values   = Values;
+    Stack->Capacity = Capacity;
+    return 1;
+}
+
+static ak_json_value* AK_Json__Value_Stack_Push(ak_json__value_stack* Stack, ak_json_value_type Type)
+{
+    if(Stack->Count == Stack->Capacity && !AK_Json__Value_Stack_Reserve(Stack, Stack->Capacity ? Stack->Capacity*2 : 64)) 
+        return NULL;
+    
+    ak_json_value* Value = Stack->Values + Stack->Count++;
+    Value->Tag = AK_Json__Tag(Type, 0);
+    return Value;
+}
+
+//NOTE(EVERYONE): Moves everything above Base into the arena and replaces it with a single array value
+static ak_json_value* AK_Json__Value_Stack_Pop_Array(ak_json__value_stack* Stack, ak_json__arena* Arena, ak_json_u64 Base)
+{
+    AK_JSON_ASSERT(Base <= Stack->Count);
+    unsigned int Count = (unsigned int)(Stack->Count-Base);
+    
+    ak_json_value* Values = NULL;
+    if(Count)
+    {
+        Values = (ak_json_value*)AK_Json__Arena_Push(Arena, Count*sizeof(ak_json_value));
+        if(!Values) return NULL;
+        AK_Json__Memory_Copy(Values, Stack->Values+Base, Count*sizeof(ak_json_value));
+    }
+    
+    Stack->Count = Base;
+    ak_json_value* Value = AK_Json__Value_Stack_Push(Stack, AK_JSON_VALUE_TYPE_ARRAY);
+    if(!Value) return NULL;
+    Value->Tag    = AK_Json__Tag(AK_JSON_VALUE_TYPE_ARRAY, Count);
+    Value->Values = Values;
+    return Value;
+}
+
+//NOTE(EVERYONE): Objects are parsed as alternating key strings and values, so everything above Base are 
+//Count pairs that get moved into the arena as one block of keys followed by the hash index
+static ak_json_value* AK_Json__Value_Stack_Pop_Object(ak_json__value_stack* Stack, ak_json__arena* Arena, ak_json_u64 Base)
+{
+    AK_JSON_ASSERT(Base <= Stack->Count && !((Stack->Count-Base) & 1));
+    unsigned int Count = (unsigned int)((Stack->Count-Base)/2);
+    
+    ak_json_key* Keys = NULL;
+    if(Count)
+    {
+        ak_json_u32 SlotCount = AK_Json__Object_Get_Slot_Count(Count);
+        Keys = (ak_json_key*)AK_Json__Arena_Push(Arena, Count*sizeof(ak_json_key) + SlotCount*sizeof(ak_json_u32));
+        if(!Keys) return NULL;
+        
+        ak_json_value* Pair = Stack->Values+Base;
+        unsigned int Index;
+        for(Index = 0; Index < Count; Index++, Pair += 2)
+        {
+            AK_JSON_ASSERT(AK_Json__Tag_Get_Type(Pair[0].Tag) == AK_JSON_VALUE_TYPE_STRING);
+            Keys[Index].Name  = Pair[0].String;
+            Keys[Index].Value = Pair[1];
+        }
+    }
+    
+    Stack->Count = Base;
+    ak_json_value* Value = AK_Json__Value_Stack_Push(Stack, AK_JSON_VALUE_TYPE_OBJECT);
+    if(!Value) return NULL;
+    Value->Tag  = AK_Json__Tag(AK_JSON_VALUE_TYPE_OBJECT, Count);
+    Value->Keys = Keys;
+    if(AK_Json__Object_Get_Slot_Count(Count)) AK_Json__Object_Build_Index((ak_json_object*)Value);
+    return Value;
+}
+
+static ak_json_value* AK_Json__Value_Stack_Pop_Root(ak_json__value_stack* Stack, ak_json__arena* Arena)
+{
+    AK_JSON_ASSERT(Stack->Count == 1);
+    ak_json_value* Value = (ak_json_value*)AK_Json__Arena_Push(Arena, sizeof(ak_json_value));
+    if(!Value) return NULL;
+    *Value = Stack->Values[0];
+    Stack->Count = 0;
+    return Value;
+}
+
+static ak_json_value* AK_Json__Value_Number(ak_json__value_stack* Stack, ak_json_str NumberStr)
+{
+    ak_json_value* Value = AK_Json__Value_Stack_Push(Stack, AK_JSON_VALUE_TYPE_NUMBER);
+    if(!Value) return NULL;
+    ak_json__number Number;
+    if(!AK_Json__Json_Str_To_Integer(NumberStr, &Number))
+    {
+        Number.Type  = AK_JSON__NUMBER_TYPE_FLOAT;
+        Number.Float = AK_Json__Json_Str_To_Number(NumberStr);
+    }
+    Value->Tag    = AK_Json__Tag(AK_JSON_VALUE_TYPE_NUMBER, Number.Type);
+    Value->Uint64 = Number.Uint64;
+    return Value;
+}
+
+//NOTE(EVERYONE): Keys with escapes are decoded first so "\u0061" and "a" intern to the same key
+static ak_json_value* AK_Json__Value_Key(ak_json__value_stack* Stack, ak_json__arena* Arena, ak_json__key_table* Keys, ak_json_str JsonStr, int HasEscapes)
+{
+    //NOTE(EVERYONE): Remove quotes from string
+    JsonStr.Str = JsonStr.Str+1;
+    JsonStr.Length -= 2;
+    if(HasEscapes)
+    {
+        JsonStr = AK_Json__Json_Str_To_UTF8(Arena, JsonStr, HasEscapes);
+        if(!JsonStr.Str) return NULL;
+    }
+    
+    ak_json_value* Value = AK_Json__Value_Stack_Push(Stack, AK_JSON_VALUE_TYPE_STRING);
+    if(!Value) return NULL;
+    ak_json_str Name = AK_Json__Key_Table_Intern(Keys, JsonStr);
+    if(!Name.Str) return NULL;
+    Value->Tag    = AK_Json__Tag(AK_JSON_VALUE_TYPE_STRING, Name.Length);
+    Value->String = Name.Str;
+    return Value;
+}
+
+static ak_json_value* AK_Json__Value_String(ak_json__value_stack* Stack, ak_json__arena* Arena, ak_json_str JsonStr, int HasEscapes)
+{
+    //NOTE(EVERYONE): Remove quotes from string
+    JsonStr.Str = JsonStr.Str+1;
+    JsonStr.Length -= 2;
+    
+    ak_json_value* Value = AK_Json__Value_Stack_Push(Stack, AK_JSON_VALUE_TYPE_STRING);
+    if(!Value) return NULL;
+    ak_json_str String = AK_Json__Json_Str_To_UTF8(Arena, JsonStr, HasEscapes);
+    if(!String.Str && JsonStr.Length) return NULL;
+    Value->Tag    = AK_Json__Tag(AK_JSON_VALUE_TYPE_STRING, String.Length);
+    Value->String = String.Str;
+    return Value;
+}
+
+/**************
+*** Prepass ***
+***************/
+
+//NOTE(EVERYONE): Large documents get a counting pass before parsing. It finds every container's length and 
+//every string's raw length, which adds up to the exact size of the containers and a tight upper bound for the 
+//strings. The document's arena then starts with one block of that size and the whole DOM goes into it, instead 
+//of a chain of blocks. Anything unexpected, like broken input or very deep nesting, just skips the prepass and 
+//leaves the errors to the parser. The scan runs at roughly 3-4 times the speed of the parser, so it trades 
+//about a fifth of the parse time for the memory. AK_Json_Parse doesn't run it, since a context keeps its 
+//blocks between parses and there is nothing to save
+#ifndef AK_JSON_PREPASS_MIN_SIZE
+#define AK_JSON_PREPASS_MIN_SIZE (256*1024)
+#endif
+
+#define AK_JSON__PREPASS_MAX_DEPTH 256
+
+typedef struct ak_json__prepass_level
+{
+    ak_json_u8  Close;
+    ak_json_u64 Open;
+    ak_json_u64 Commas;
+} ak_json__prepass_level;
+
+static ak_json_u64 AK_Json__Prepass_Key_Size(ak_json_u64 Length, int HasEscapes)
+{
+    //NOTE(EVERYONE): Keys are interned into the same arena, and escaped keys get decoded first. Interning is 
+    //counted for every key as if none of them repeat
+    ak_json_u64 Result = AK_Json__Arena_Align(sizeof(ak_json__interned_key)+Length);
+    if(HasEscapes) Result += AK_Json__Arena_Align(Length);
+    return Result;
+}
+
+//NOTE(EVERYONE): Returns the number of arena bytes parsing Str takes at most, or 0 when it can't tell. The 
+//input is classified 64 bytes at a time, and only quotes and the operators outside of strings are visited 
+//one by one
+static ak_json_u64 AK_Json__Prepass(ak_json_str Str)
+{
+    ak_json__prepass_level Levels[AK_JSON__PREPASS_MAX_DEPTH+1];
+    ak_json__prepass_level* Level = Levels;
+    ak_json_u64 Depth = 0;
+    ak_json_u64 Size = sizeof(ak_json_value);
+    
+    //NOTE(EVERYONE): Strings are counted as values when they close and turned into keys when a colon follows. 
+    //A container is empty when the last non whitespace byte before it closes is the one that opened it
+    ak_json_u64 StringStart = 0;
+    ak_json_u64 LastStringLength = 0;
+    int LastStringHasEscapes = 0;
+    ak_json_u64 LastBackslash = 0;
+    ak_json_u64 LastNonWhitespace = 0;
+    
+    ak_json_u64 PrevEscaped  = 0;
+    ak_json_u64 PrevInString = 0;
+    
+    ak_json_u64 BlockStart;
+    for(BlockStart = 0; BlockStart < Str.Length; BlockStart += AK_JSON__BLOCK_SIZE)
+    {
+        ak_json__block_masks Masks;
+        ak_json_u64 Remaining = Str.Length-BlockStart;
+        if(Remaining >= AK_JSON__BLOCK_SIZE)
+        {
+            Masks = AK_Json__Classify_Block(Str.Str+BlockStart);
+        }
+        else
+        {
+            //NOTE(EVERYONE): Pad the final block with whitespace so it never reads past the input
+            ak_json_u8 Block[AK_JSON__BLOCK_SIZE];
+            AK_JSON_MEMSET(Block, ' ', AK_JSON__BLOCK_SIZE);
+            AK_Json__Memory_Copy(Block, Str.Str+BlockStart, Remaining);
+            Masks = AK_Json__Classify_Block(Block);
+        }
+        
+        //NOTE(EVERYONE): A backslash escapes the next character unless it was escaped itself. Backslashes 
+        //are rare outside of escape heavy strings, so walking them one at a time is cheap
+        ak_json_u64 Escaped = PrevEscaped;
+        ak_json_u64 Backslash = Masks.Backslash & ~PrevEscaped;
+        PrevEscaped = 0;
+        while(Backslash)
+        {
+            unsigned int Bit = AK_Json__Count_Trailing_Zeros(Backslash);
+            Backslash &= Backslash-1;
+            if(Bit == 63)
+            {
+                PrevEscaped = 1;
+            }
+            else
+            {
+                Escaped |= 1ull << (Bit+1);
+                Backslash &= ~(1ull << (Bit+1));
+            }
+        }
+        
+        ak_json_u64 Quote = Masks.Quote & ~Escaped;
+        ak_json_u64 InString = AK_Json__Prefix_Xor(Quote) ^ PrevInString;
+        PrevInString = 0ull - (InString >> 63);
+        
+        ak_json_u64 NonWhitespace = ~Masks.Whitespace;
+        ak_json_u64 Events = (Masks.Operator & ~InString) | Quote;
+        while(Events)
+        {
+            unsigned int Bit = AK_Json__Count_Trailing_Zeros(Events);
+            ak_json_u64 Below = (1ull << Bit)-1;
+            Events &= Events-1;
+            
+            ak_json_u64 Offset = BlockStart+Bit;
+            ak_json_u8 Char = Str.Str[Offset];
+            switch(Char)
+            {
+                case '"':
+                {
+                    if(InString & (1ull << Bit))
+                    {
+                        StringStart = Offset;
+                        break;
+                    }
+                    
+                    //NOTE(EVERYONE): The raw length plus the null terminator, decoding escapes only shrinks it
+                    LastStringLength = Offset-StringStart;
+                    ak_json_u64 Backslashes = Masks.Backslash & Below;
+                    LastStringHasEscapes = (Backslashes ? BlockStart + 63-AK_Json__Count_Leading_Zeros(Backslashes) : LastBackslash) > StringStart;
+                    Size += AK_Json__Arena_Align(LastStringLength);
+                } break;
+                
+                case ':':
+                {
+                    if(!LastStringLength) return 0;
+                    Size += AK_Json__Prepass_Key_Size(LastStringLength, LastStringHasEscapes) - AK_Json__Arena_Align(LastStringLength);
+                    LastStringLength = 0;
+                } break;
+                
+                case '[':
+                case '{':
+                {
+                    if(Depth == AK_JSON__PREPASS_MAX_DEPTH) return 0;
+                    Level = Levels + ++Depth;
+                    Level->Close  = Char == '[' ? ']' : '}';
+                    Level->Open   = Offset;
+                    Level->Commas = 0;
+                } break;
+                
+                case ']':
+                case '}':
+                {
+                    if(!Depth || Level->Close != Char) return 0;
+                    
+                    ak_json_u64 NonWhitespaceBelow = NonWhitespace & Below;
+                    ak_json_u64 Last = NonWhitespaceBelow ? BlockStart + 63-AK_Json__Count_Leading_Zeros(NonWhitespaceBelow) : LastNonWhitespace;
+                    ak_json_u64 Count = Last == Level->Open ? 0 : Level->Commas+1;
+                    Level = Levels + --Depth;
+                    
+                    if(Count > 0xFFFFFFFFull) return 0;
+                    if(Char == ']') Size += AK_Json__Arena_Align(Count*sizeof(ak_json_value));
+                    else Size += AK_Json__Arena_Align(Count*sizeof(ak_json_key) + AK_Json__Object_Get_Slot_Count((unsigned int)Count)*sizeof(ak_json_u32));
+                } break;
+                
+                case ',':
+                {
+                    if(!Depth) return 0;
+                    Level->Commas++;
+                } break;
+            }
+        }
+        
+        if(Masks.Backslash) LastBackslash = BlockStart + 63-AK_Json__Count_Leading_Zeros(Masks.Backslash);
+        if(NonWhitespace) LastNonWhitespace = BlockStart + 63-AK_Json__Count_Leading_Zeros(NonWhitespace);
+    }
+    
+    return Depth || PrevInString ? 0 : Size;
+}
+
+#ifdef AK_JSON_TWO_PASS_PARSER
+//NOTE(EVERYONE): The two pass parser's token tape, see the tokenizer below. It is scratch memory like the 
+//value stack, so the context keeps it between parses
+typedef struct ak_json__token_tape
+{
+    ak_json_allocator Allocator;
+    ak_json_u64*      Entries;
+    ak_json_u64       Count;
+    ak_json_u64       Capacity;
+} ak_json__token_tape;
+
+static void AK_Json__Token_Tape_Create(ak_json__token_tape* Tape, ak_json_allocator Allocator)
+{
+    Tape->Allocator = Allocator;
+    Tape->Entries   = NULL;
+    Tape->Count     = 0;
+    Tape->Capacity  = 0;
+}
+
+static void AK_Json__Token_Tape_Delete(ak_json__token_tape* Tape)
+{
+    AK_Json__Free(&Tape->Allocator, Tape->Entries);
+    Tape->Entries = NULL;
+    Tape->Count = Tape->Capacity = 0;
+}
+
+static int AK_Json__Token_Tape_Reserve(ak_json__token_tape* Tape, ak_json_u64 Capacity)
+{
+    if(Capacity <= Tape->Capacity) return 1;
+    
+    ak_json_u64* Entries = (ak_json_u64*)AK_Json__Allocate(&Tape->Allocator, Capacity*sizeof(ak_json_u64));
+    if(!Entries) return 0;
+    
+    if(Tape->Entries)
+    {
+        AK_Json__Memory_Copy(Entries, Tape->Entries, Tape->Count*sizeof(ak_json_u64));
+        AK_Json__Free(&Tape->Allocator, Tape->Entries);
+    }
+    
+    Tape->Entries  = Entries;
+    Tape->Capacity = Capacity;
+    return 1;
+}
+#endif
+
+/************************
+*** Creating/Deleting ***
+*************************/
+
+//NOTE(EVERYONE): Besides the arena the context owns the scratch memory parsing needs, so parsing into a 
+//context that has seen a similar input before does not call the allocator. DocumentKeys only lends its slots 
+//to one document parse at a time, the keys themselves go into the document
+typedef struct ak_json_context
+{
+    ak_json__arena*           Arena;
+    ak_json__key_table        Keys;
+    ak_json__key_table        DocumentKeys;
+    ak_json__value_stack      Values;
+#ifdef AK_JSON_TWO_PASS_PARSER
+    ak_json__token_tape       Tape;
+#endif
+} ak_json_context;
+
+AK_JSON_DEF ak_json_context* AK_Json_Create(ak_json_allocator* pAllocator)
+{
+    ak_json_allocator Allocator = pAllocator ? *pAllocator : AK_Json__Get_Default_Allocator();
+    ak_json__arena* Arena = AK_Json__Arena_Create(Allocator, 1024*1024);
+    if(!Arena) return NULL;
+    
+    ak_json_context* Result = (ak_json_context*)AK_Json__Arena_Push(Arena, sizeof(ak_json_context));
+    AK_Json__Memory_Clear(Result, sizeof(ak_json_context));
+    Result->Arena = Arena;
+    Result->Keys.Allocator = Allocator;
+    Result->Keys.Arena = Arena;
+    Result->DocumentKeys.Allocator = Allocator;
+    AK_Json__Value_Stack_Create(&Result->Values, Allocator);
+#ifdef AK_JSON_TWO_PASS_PARSER
+    AK_Json__Token_Tape_Create(&Result->Tape, Allocator);
+#endif
+    return Result;
+}
+
+AK_JSON_DEF void AK_Json_Delete(ak_json_context* Context)
+{
+    if(Context)
+    {
+        ak_json__arena* Arena = Context->Arena;
+        AK_Json__Key_Table_Delete(&Context->Keys);
+        AK_Json__Key_Table_Delete(&Context->DocumentKeys);
+        AK_Json__Value_Stack_Delete(&Context->Values);
+#ifdef AK_JSON_TWO_PASS_PARSER
+        AK_Json__Token_Tape_Delete(&Context->Tape);
+#endif
+        AK_Json__Arena_Delete(Arena);
+    }
+}
+
+//NOTE(EVERYONE): Throws away everything parsed with the context but keeps its memory for the next parse. 
+//A MaxSize above 0 trims the context back to roughly that many bytes first: the blocks of each arena are 
+//kept until they add up to MaxSize, and scratch buffers larger than MaxSize are freed
+AK_JSON_DEF void AK_Json_Context_Reset(ak_json_context* Context, ak_json_u64 MaxSize)
+{
+    ak_json__arena* Arena = Context->Arena;
+    AK_Json__Arena_Reset(Arena, MaxSize);
+    
+    //NOTE(EVERYONE): The context is always the first thing in its arena, so pushing it again hands back 
+    //the same memory and leaves it untouched. The push has to happen even when asserts are compiled out
+    ak_json_context* Result = (ak_json_context*)AK_Json__Arena_Push(Arena, sizeof(ak_json_context));
+    AK_JSON_ASSERT(Result == Context);
+    (void)Result;
+    
+    AK_Json__Key_Table_Clear(&Context->Keys);
+    if(MaxSize)
+    {
+        if(Context->Keys.SlotCount*sizeof(ak_json__interned_key*) > MaxSize) AK_Json__Key_Table_Delete(&Context->Keys);
+        if(Context->DocumentKeys.SlotCount*sizeof(ak_json__interned_key*) > MaxSize) AK_Json__Key_Table_Delete(&Context->DocumentKeys);
+        if(Context->Values.Capacity*sizeof(ak_json_value) > MaxSize) AK_Json__Value_Stack_Delete(&Context->Values);
+#ifdef AK_JSON_TWO_PASS_PARSER
+        if(Context->Tape.Capacity*sizeof(ak_json_u64) > MaxSize) AK_Json__Token_Tape_Delete(&Context->Tape);
+#endif
+    }
+}
+
+//NOTE(EVERYONE): Define AK_JSON_TWO_PASS_PARSER to tokenize the whole input before parsing it. 
+//This is the original implementation and is kept around to compare against the single pass parser
+#ifdef AK_JSON_TWO_PASS_PARSER
+
+/****************************
+*** Tokenizing (Two Pass) ***
+*****************************/
+
+typedef enum ak_json__token_type
+{
+    AK_JSON__TOKEN_TYPE_UNDEFINED,
+    AK_JSON__TOKEN_TYPE_NULL,
+    AK_JSON__TOKEN_TYPE_BOOLEAN,
+    AK_JSON__TOKEN_TYPE_NUMBER,
+    AK_JSON__TOKEN_TYPE_STRING,
+    AK_JSON__TOKEN_TYPE_COMMA,
+    AK_JSON__TOKEN_TYPE_ARRAY_START,
+    AK_JSON__TOKEN_TYPE_ARRAY_END,
+    AK_JSON__TOKEN_TYPE_OBJECT_START,
+    AK_JSON__TOKEN_TYPE_OBJECT_END,
+    AK_JSON__TOKEN_TYPE_OBJECT_KEY_DELIMITER,
+    AK_JSON__TOKEN_TYPE_TERMINATOR
+} ak_json__token_type;
+
+//NOTE(EVERYONE): Tokens are stored in a contiguous tape of packed 8 byte entries. The upper 
+//bits of an entry hold the token type and the lower bits hold the byte offset into the input. 
+//Only numbers and strings need a length, which is stored in the entry that follows them
+#define AK_JSON__TOKEN_TYPE_SHIFT  60
+#define AK_JSON__TOKEN_OFFSET_MASK ((1ull << AK_JSON__TOKEN_TYPE_SHIFT)-1)
+
+//NOTE(EVERYONE): The top bit of a string length entry marks strings that contain escapes
+#define AK_JSON__TOKEN_ESCAPE_BIT (1ull << 63)
+
+typedef struct ak_json__token
+{
+    ak_json__token_type Type;
+    ak_json_u64         Offset;
+    ak_json_u64         Length;
+    int                 HasEscapes;
+} ak_json__token;
+
+static int AK_Json__Token_Type_Has_Length(ak_json__token_type Type)
+{
+    return Type == AK_JSON__TOKEN_TYPE_NUMBER || Type == AK_JSON__TOKEN_TYPE_STRING;
+}
+
+static ak_json_str AK_Json__Token_Get_Str(ak_json_str Str, ak_json__token Token)
+{
+    ak_json_str Result = AK_Json_Str__Substr(Str, Token.Offset, Token.Offset+Token.Length);
+    return Result;
+}
+
+static ak_json__token AK_Json__Token_Tape_Get(ak_json__token_tape* Tape, ak_json_u64 Index)
+{
+    AK_JSON_ASSERT(Index < Tape->Count);
+    ak_json_u64 Entry = Tape->Entries[Index];
+    
+    ak_json__token Token;
+    Token.Type   = (ak_json__token_type)(Entry >> AK_JSON__TOKEN_TYPE_SHIFT);
+    Token.Offset = Entry & AK_JSON__TOKEN_OFFSET_MASK;
+    Token.Length = AK_Json__Token_Type_Has_Length(Token.Type) ? Tape->Entries[Index+1] : 1;
+    Token.HasEscapes = (Token.Length & AK_JSON__TOKEN_ESCAPE_BIT) != 0;
+    Token.Length &= ~AK_JSON__TOKEN_ESCAPE_BIT;
+    return Token;
+}
+
+typedef struct ak_json__tokenizer
+{
+    ak_json__token_tape Tape;
+    ak_json_u64         Depth;
+} ak_json__tokenizer;
+
+static int AK_Json__Tokenizer_Add_Token(ak_json__tokenizer* Tokenizer, ak_json__token_type Type, ak_json_u64 Offset, ak_json_u64 Length)
+{
+    ak_json__token_tape* Tape = &Tokenizer->Tape;
+    if(Tape->Count+2 > Tape->Capacity && !AK_Json__Token_Tape_Reserve(Tape, Tape->Capacity*2 + 16)) return 0;
+    
+    Tape->Entries[Tape->Count++] = ((ak_json_u64)Type << AK_JSON__TOKEN_TYPE_SHIFT) | (Offset & AK_JSON__TOKEN_OFFSET_MASK);
+    if(AK_Json__Token_Type_Has_Length(Type)) Tape->Entries[Tape->Count++] = Length;
+    return 1;
+}
+
+static int AK_Json__Tokenize_Generic(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream);
+
+static int AK_Json__Tokenize_Value(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+{
+    AK_Json__Stream_Eat_Whitespace(Stream);
+    
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    
+    int Result = 1;
+    ak_json__token_type Type = AK_JSON__TOKEN_TYPE_UNDEFINED;
+    ak_json_u64 Flags = 0;
+    switch(Char.Char)
+    {
+        case 'n':
+        {
+            Type = AK_JSON__TOKEN_TYPE_NULL;
+            Result = AK_Json__Scan_Null(Stream);
+            if(!Result)
+            {
+                AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting null value. Got undefined."));
+            }
+        } break;
+        
+        case 't':
+        case 'f':
+        {
+            int Boolean;
+            Type = AK_JSON__TOKEN_TYPE_BOOLEAN;
+            Result = AK_Json__Scan_Boolean(Stream, &Boolean);
+            if(!Result)
+            {
+                AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting boolean value. Got undefined."));
+            }
+        } break;
+        
+        case '"':
+        {
+            int HasEscapes;
+            Type = AK_JSON__TOKEN_TYPE_STRING;
+            Result = AK_Json__Scan_String(Stream, &HasEscapes);
+            if(HasEscapes) Flags = AK_JSON__TOKEN_ESCAPE_BIT;
+            if(!Result)
+            {
+                AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting string value. Got undefined."));
+            }
+        } break;
+        
+        default:
+        {
+            Type = AK_JSON__TOKEN_TYPE_NUMBER;
+            Result = AK_Json__Scan_Number(Stream);
+            if(!Result)
+            {
+                AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting numeric value. Got undefined."));
+            }
+        } break;
+    }
+    
+    if(Result)
+    {
+        if(!AK_Json__Tokenizer_Add_Token(Tokenizer, Type, Char.Index, (Stream->StrIndex-Char.Index) | Flags)) return 0;
+        AK_Json__Stream_Eat_Whitespace(Stream);
+    }
+    return Result;
+}
+
+static int AK_Json__Tokenize_Array(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+{
+    ak_json__char StartChar = AK_Json__Stream_Consume_Char(Stream);
+    AK_JSON_ASSERT(StartChar.Char == '[');
+    
+    if(!AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_ARRAY_START, StartChar.Index, 1)) return 0;
+    
+    while(AK_Json__Stream_Is_Valid(Stream))
+    {
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+        if(Char.Char == ']')
+        {
+            if(!AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_ARRAY_END, Char.Index, 1)) return 0;
+            AK_Json__Stream_Increment(Stream);
+            return 1;
+        }
+        else if(Char.Char == ',')
+        {
+            if(!AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_COMMA, Char.Index, 1)) return 0;
+            AK_Json__Stream_Increment(Stream);
+        }
+        else
+        {
+            if(!AK_Json__Tokenize_Generic(Tokenizer, Stream))
+                return 0;
+        }
+    }
+    
+    //NOTE(EVERYONE): Add an undefined token and handle the error later
+    return AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_UNDEFINED, StartChar.Index, 0);
+}
+
+static int AK_Json__Tokenize_Object(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+{
+    ak_json__char StartChar = AK_Json__Stream_Consume_Char(Stream);
+    AK_JSON_ASSERT(StartChar.Char == '{');
+    
+    if(!AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_OBJECT_START, StartChar.Index, 1)) return 0;
+    
+    while(AK_Json__Stream_Is_Valid(Stream))
+    {
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+        
+        if(Char.Char == '}')
+        {
+            if(!AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_OBJECT_END, Char.Index, 1)) return 0;
+            AK_Json__Stream_Increment(Stream);
+            return 1;
+        }
+        else if(Char.Char == ':')
+        {
+            if(!AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_OBJECT_KEY_DELIMITER, Char.Index, 1)) return 0;
+            AK_Json__Stream_Increment(Stream);
+        }
+        else if(Char.Char == ',')
+        {
+            if(!AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_COMMA, Char.Index, 1)) return 0;
+            AK_Json__Stream_Increment(Stream);
+        }
+        else
+        {
+            if(!AK_Json__Tokenize_Generic(Tokenizer, Stream))
+                return 0;
+        }
+    }
+    
+    //NOTE(EVERYONE): Add an undefined token and handle the error later
+    return AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_UNDEFINED, StartChar.Index, 0);
+}
+
+static int AK_Json__Tokenize_Generic(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+{
+    int Result = 0;
+    if(AK_Json__Stream_Is_Valid(Stream))
+    {
+        ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+        switch(Char.Char)
+        {
+            case '[':
+            case '{':
+            {
+                int IsArray = Char.Char == '[';
+                if(Tokenizer->Depth == AK_JSON_MAX_DEPTH)
+                {
+                    AK_Json__Error_Log(Stream->Str, IsArray ? AK_JSON_ERROR_CODE_ARRAY_PARSING : AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_JSON__INTERNAL_ERROR_MAX_DEPTH);
+                    break;
+                }
+                
+                Tokenizer->Depth++;
+                Result = IsArray ? AK_Json__Tokenize_Array(Tokenizer, Stream) : AK_Json__Tokenize_Object(Tokenizer, Stream);
+                Tokenizer->Depth--;
+            } break;
+            
+            default:
+            {
+                Result = AK_Json__Tokenize_Value(Tokenizer, Stream);
+            } break;
+        }
+    }
+    
+    return Result;
+}
+
+static int AK_Json__Tokenize(ak_json__tokenizer* Tokenizer, ak_json_str Str)
+{
+    ak_json__stream Stream = AK_Json__Stream_Create(Str);
+    AK_Json__Stream_Eat_Whitespace(&Stream);
+    
+    int Result = AK_Json__Tokenize_Generic(Tokenizer, &Stream);
+    
+    if(Result)
+    {
+        AK_Json__Stream_Eat_Whitespace(&Stream);
+        if(AK_Json__Stream_Is_Valid(&Stream))
+        {
+            //NOTE(EVERYONE): There shouldn't be anymore remaining items here
+            //TODO(JJ): Log error
+            ak_json__char Char = AK_Json__Stream_Peek_Char(&Stream);
+            AK_Json__Error_Log(Str, AK_JSON_ERROR_CODE_EXPECTED_END_OF_STREAM, Char, AK_JSON__INTERNAL_ERROR_EXPECTED_EOF);
+            return 0;
+        }
+        
+        Result = AK_Json__Tokenizer_Add_Token(Tokenizer, AK_JSON__TOKEN_TYPE_TERMINATOR, Str.Length, 0);
+    }
+    
+    return Result;
+}
+
+typedef enum ak_json__object_parsing_state
+{
+    AK_JSON__OBJECT_PARSING_STATE_INITIAL,
+    AK_JSON__OBJECT_PARSING_STATE_KEY,
+    AK_JSON__OBJECT_PARSING_STATE_DELIMTER,
+    AK_JSON__OBJECT_PARSING_STATE_VALUE,
+    AK_JSON__OBJECT_PARSING_STATE_COMMA
+} ak_json__object_parsing_state;
+
+typedef struct ak_json__parser
+{
+    ak_json__arena*      Arena;
+    ak_json__value_stack Values;
+    ak_json__key_table*  Keys;
+    ak_json_str          Str;
+    ak_json__token_tape* Tape;
+    ak_json_u64          TapeIndex;
+    ak_json_u64          Depth;
+} ak_json__parser;
+
+static ak_json_value* AK_Json__Parse_Generic(ak_json__parser* Parser);
+
+static ak_json__token AK_Json__Parser_Peek_Token(ak_json__parser* Parser)
+{
+    return AK_Json__Token_Tape_Get(Parser->Tape, Parser->TapeIndex);
+}
+
+static void AK_Json__Parser_Increment_Token(ak_json__parser* Parser)
+{
+    ak_json__token_type Type = (ak_json__token_type)(Parser->Tape->Entries[Parser->TapeIndex] >> AK_JSON__TOKEN_TYPE_SHIFT);
+    AK_JSON_ASSERT(Type != AK_JSON__TOKEN_TYPE_TERMINATOR);
+    Parser->TapeIndex += AK_Json__Token_Type_Has_Length(Type) ? 2 : 1;
+}
+
+static ak_json__token AK_Json__Parser_Consume_Token(ak_json__parser* Parser)
+{
+    ak_json__token Result = AK_Json__Parser_Peek_Token(Parser);
+    AK_Json__Parser_Increment_Token(Parser);
+    return Result;
+}
+
+static ak_json__char AK_Json__Parser_Get_Char(ak_json__parser* Parser, ak_json__token Token)
+{
+    ak_json__char Result;
+    Result.Index = Token.Offset;
+    Result.Char = Parser->Str.Str[Token.Offset];
+    return Result;
+}
+
+static ak_json_value* AK_Json__Parse_Null_Value(ak_json__parser* Parser)
+{
+    ak_json__token Token = AK_Json__Parser_Consume_Token(Parser);
+    AK_JSON_ASSERT(Token.Type == AK_JSON__TOKEN_TYPE_NULL);
+    return AK_Json__Value_Stack_Push(&Parser->Values, AK_JSON_VALUE_TYPE_NULL);
+}
+
+static ak_json_value* AK_Json__Parse_Boolean_Value(ak_json__parser* Parser)
+{
+    ak_json__token Token = AK_Json__Parser_Consume_Token(Parser);
+    AK_JSON_ASSERT(Token.Type == AK_JSON__TOKEN_TYPE_BOOLEAN);
+    
+    //NOTE(EVERYONE): The tokenizer already validated the literal, so the first character is enough
+    int Boolean = Parser->Str.Str[Token.Offset] == 't';
+    ak_json_value* Value = AK_Json__Value_Stack_Push(&Parser->Values, AK_JSON_VALUE_TYPE_BOOLEAN);
+    if(Value) Value->Tag = AK_Json__Tag(AK_JSON_VALUE_TYPE_BOOLEAN, (ak_json_u64)Boolean);
+    return Value;
+}
+
+static ak_json_value* AK_Json__Parse_Number_Value(ak_json__parser* Parser)
+{
+    ak_json__token Token = AK_Json__Parser_Consume_Token(Parser);
+    AK_JSON_ASSERT(Token.Type == AK_JSON__TOKEN_TYPE_NUMBER);
+    return AK_Json__Value_Number(&Parser->Values, AK_Json__Token_Get_Str(Parser->Str, Token));
+}
+
+static ak_json_value* AK_Json__Parse_String_Value(ak_json__parser* Parser)
+{
+    ak_json__token Token = AK_Json__Parser_Consume_Token(Parser);
+    AK_JSON_ASSERT(Token.Type == AK_JSON__TOKEN_TYPE_STRING);
+    return AK_Json__Value_String(&Parser->Values, Parser->Arena, AK_Json__Token_Get_Str(Parser->Str, Token), Token.HasEscapes);
+}
+
+static ak_json_value* AK_Json__Parse_Key(ak_json__parser* Parser)
+{
+    ak_json__token Token = AK_Json__Parser_Consume_Token(Parser);
+    AK_JSON_ASSERT(Token.Type == AK_JSON__TOKEN_TYPE_STRING);
+    return AK_Json__Value_Key(&Parser->Values, Parser->Arena, Parser->Keys, AK_Json__Token_Get_Str(Parser->Str, Token), Token.HasEscapes);
+}
+
+static ak_json_value* AK_Json__Parse_Array_Value(ak_json__parser* Parser)
+{
+    ak_json__token StartToken = AK_Json__Parser_Consume_Token(Parser);
+    AK_JSON_ASSERT(StartToken.Type == AK_JSON__TOKEN_TYPE_ARRAY_START);
+    
+    int HasFinishedCorrectly = 0;
+    ak_json_u64 Base = Parser->Values.Count;
+    
+    int NeedsValue = 1;
+    int CanFinish = 1;
+    ak_json__token Token = AK_Json__Parser_Peek_Token(Parser);
+    
+    while(Token.Type != AK_JSON__TOKEN_TYPE_TERMINATOR && !HasFinishedCorrectly)
+    {
+        switch(Token.Type)
+        {
+            case AK_JSON__TOKEN_TYPE_ARRAY_END:
+            {
+                if(!CanFinish) 
+                {
+                    AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, AK_Json__Parser_Get_Char(Parser, Token), AK_Json_Str("Error parsing array. Expected a value after ,"));
+                    return NULL;
+                }
+                HasFinishedCorrectly = 1;
+                AK_Json__Parser_Increment_Token(Parser);
+            } break;
+            
+            case AK_JSON__TOKEN_TYPE_COMMA:
+            {
+                if(NeedsValue)
+                {
+                    AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, AK_Json__Parser_Get_Char(Parser, Token), AK_Json_Str("Error parsing array. Expected a value before ,"));
+                    return NULL;
+                }
+                
+                AK_Json__Parser_Increment_Token(Parser);
+                NeedsValue = 1;
+                CanFinish = 0;
+            } break;
+            
+            case AK_JSON__TOKEN_TYPE_UNDEFINED:
+            case AK_JSON__TOKEN_TYPE_TERMINATOR:
+            {
+                //NOTE(EVERYONE): The tokenizer ran out of characters before the array was closed
+                Token.Type = AK_JSON__TOKEN_TYPE_TERMINATOR;
+                continue;
+            } break;
+            
+            default:
+            {
+                if(!NeedsValue)
+                {
+                    AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, AK_Json__Parser_Get_Char(Parser, Token), AK_Json_Str("Error parsing array. Expected , or ] characters."));
+                    return NULL;
+                }
+                
+                if(!AK_Json__Parse_Generic(Parser)) return NULL;
+                
+                NeedsValue = 0;
+                CanFinish = 1;
+            } break;
+        }
+        
+        Token = AK_Json__Parser_Peek_Token(Parser);
+    }
+    
+    if(!HasFinishedCorrectly)
+    {
+        AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, AK_Json__Parser_Get_Char(Parser, StartToken), AK_Json_Str("Error parsing array. Expected , or ] characters. Got EOF."));
+        return NULL;
+    }
+    
+    return AK_Json__Value_Stack_Pop_Array(&Parser->Values, Parser->Arena, Base);
+}
+
+static ak_json_value* AK_Json__Parse_Object_Value(ak_json__parser* Parser)
+{
+    ak_json__token StartToken = AK_Json__Parser_Consume_Token(Parser);
+    AK_JSON_ASSERT(StartToken.Type == AK_JSON__TOKEN_TYPE_OBJECT_START);
+    
+    ak_json_u64 Base = Parser->Values.Count;
+    ak_json__object_parsing_state ParsingState = AK_JSON__OBJECT_PARSING_STATE_INITIAL;
+    
+    ak_json__token Token = AK_Json__Parser_Peek_Token(Parser);
+    while(Token.Type != AK_JSON__TOKEN_TYPE_TERMINATOR && Token.Type != AK_JSON__TOKEN_TYPE_UNDEFINED)
+    {
+        switch(Token.Type)
+        {
+            case AK_JSON__TOKEN_TYPE_OBJECT_END:
+            {
+                if((ParsingState != AK_JSON__OBJECT_PARSING_STATE_INITIAL) && 
+                   (ParsingState != AK_JSON__OBJECT_PARSING_STATE_VALUE))
+                {
+                    AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, AK_Json__Parser_Get_Char(Parser, Token), AK_Json_Str("Error parsing object. Expected a key value pair before }"));
+                    return NULL;
+                }
+                
+                AK_Json__Parser_Increment_Token(Parser);
+                return AK_Json__Value_Stack_Pop_Object(&Parser->Values, Parser->Arena, Base);
+            } break;
+            
+            case AK_JSON__TOKEN_TYPE_OBJECT_KEY_DELIMITER:
+            {
+                if(ParsingState != AK_JSON__OBJECT_PARSING_STATE_KEY)
+                {
+                    AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, AK_Json__Parser_Get_Char(Parser, Token), AK_Json_Str("Error parsing object. Expected a key before :"));
+                    return NULL;
+                }
+                
+                AK_Json__Parser_Increment_Token(Parser);
+                ParsingState = AK_JSON__OBJECT_PARSING_STATE_DELIMTER;
+            } break;
+            
+            case AK_JSON__TOKEN_TYPE_COMMA:
+            {
+                if(ParsingState != AK_JSON__OBJECT_PARSING_STATE_VALUE)
+                {
+                    AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, AK_Json__Parser_Get_Char(Parser, Token), AK_Json_Str("Error parsing object. Expected a key value pair before ,"));
+                    return NULL;
+                }
+                
+                AK_Json__Parser_Increment_Token(Parser);
+                ParsingState = AK_JSON__OBJECT_PARSING_STATE_COMMA;
+            } break;
+            
+            default:
+            {
+                if(ParsingState == AK_JSON__OBJECT_PARSING_STATE_INITIAL || 
+                   ParsingState == AK_JSON__OBJECT_PARSING_STATE_COMMA)
+                {
+                    if(Token.Type != AK_JSON__TOKEN_TYPE_STRING)
+                    {
+                        AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, AK_Json__Parser_Get_Char(Parser, Token), AK_Json_Str("Error parsing object. Expected a string key."));
+                        return NULL;
+                    }
+                    
+                    if(!AK_Json__Parse_Key(Parser)) return NULL;
+                    ParsingState = AK_JSON__OBJECT_PARSING_STATE_KEY;
+                }
+                else if(ParsingState == AK_JSON__OBJECT_PARSING_STATE_DELIMTER)
+                {
+                    if(!AK_Json__Parse_Generic(Parser)) return NULL;
+                    ParsingState = AK_JSON__OBJECT_PARSING_STATE_VALUE;
+                }
+                else
+                {
+                    ak_json_str Message = ParsingState == AK_JSON__OBJECT_PARSING_STATE_KEY ? 
+                        AK_Json_Str("Error parsing object. Expected : after key.") : 
+                        AK_Json_Str("Error parsing object. Expected , or } characters.");
+                    AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, AK_Json__Parser_Get_Char(Parser, Token), Message);
+                    return NULL;
+                }
+            } break;
+        }
+        
+        Token = AK_Json__Parser_Peek_Token(Parser);
+    }
+    
+    AK_Json__Error_Log(Parser->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, AK_Json__Parser_Get_Char(Parser, StartToken), AK_Json_Str("Error parsing object. Expected , or } characters. Got EOF."));
+    return NULL;
+}
+
+static ak_json_value* AK_Json__Parse_Generic(ak_json__parser* Parser)
+{
+    ak_json__token Token = AK_Json__Parser_Peek_Token(Parser);
+    
+    ak_json_value* RootValue = NULL;
+    switch(Token.Type)
+    {
+        case AK_JSON__TOKEN_TYPE_NULL:
+        {
+            RootValue = AK_Json__Parse_Null_Value(Parser);
+        } break;
+        
+        case AK_JSON__TOKEN_TYPE_BOOLEAN:
+        {
+            RootValue = AK_Json__Parse_Boolean_Value(Parser);
+        } break;
+        
+        case AK_JSON__TOKEN_TYPE_NUMBER:
+        {
+            RootValue = AK_Json__Parse_Number_Value(Parser);
+        } break;
+        
+        case AK_JSON__TOKEN_TYPE_STRING:
+        {
+            RootValue = AK_Json__Parse_String_Value(Parser);
+        } break;
+        
+        case AK_JSON__TOKEN_TYPE_ARRAY_START:
+        case AK_JSON__TOKEN_TYPE_OBJECT_START:
+        {
+            int IsArray = Token.Type == AK_JSON__TOKEN_TYPE_ARRAY_START;
+            if(Parser->Depth == AK_JSON_MAX_DEPTH)
+            {
+                AK_Json__Error_Log(Parser->Str, IsArray ? AK_JSON_ERROR_CODE_ARRAY_PARSING : AK_JSON_ERROR_CODE_OBJECT_PARSING, AK_Json__Parser_Get_Char(Parser, Token), AK_JSON__INTERNAL_ERROR_MAX_DEPTH);
+                break;
+            }
+            
+            Parser->Depth++;
+            RootValue = IsArray ? AK_Json__Parse_Array_Value(Parser) : AK_Json__Parse_Object_Value(Parser);
+            Parser->Depth--;
+        } break;
+        
+        default:
+        {
+            //TODO(JJ): Implement this case
+        } break;
+    }
+    
+    return RootValue;
+}
+
+
+#else
+
+/*****************************
+*** Parsing (Single Pass) ***
+*****************************/
+
+//NOTE(EVERYONE): The single pass parser builds values directly while walking the stream, 
+//so every byte is only touched once and no token list is ever allocated
+
+typedef struct ak_json__parser
+{
+    ak_json__arena*      Arena;
+    ak_json__value_stack Values;
+    ak_json__key_table*  Keys;
+    ak_json__stream      Stream;
+    ak_json_u64          Depth;
+} ak_json__parser;
+
+static ak_json_value* AK_Json__Parse_Generic(ak_json__parser* Parser);
+
+static ak_json_value* AK_Json__Parse_Null_Value(ak_json__parser* Parser)
+{
+    ak_json__stream* Stream = &Parser->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    if(!AK_Json__Scan_Null(Stream))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting null value. Got undefined."));
+        return NULL;
+    }
+    return AK_Json__Value_Stack_Push(&Parser->Values, AK_JSON_VALUE_TYPE_NULL);
+}
+
+static ak_json_value* AK_Json__Parse_Boolean_Value(ak_json__parser* Parser)
+{
+    ak_json__stream* Stream = &Parser->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    
+    int Boolean;
+    if(!AK_Json__Scan_Boolean(Stream, &Boolean))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting boolean value. Got undefined."));
+        return NULL;
+    }
+    
+    ak_json_value* Value = AK_Json__Value_Stack_Push(&Parser->Values, AK_JSON_VALUE_TYPE_BOOLEAN);
+    if(Value) Value->Tag = AK_Json__Tag(AK_JSON_VALUE_TYPE_BOOLEAN, (ak_json_u64)Boolean);
+    return Value;
+}
+
+static ak_json_value* AK_Json__Parse_Number_Value(ak_json__parser* Parser)
+{
+    ak_json__stream* Stream = &Parser->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    if(!AK_Json__Scan_Number(Stream))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting numeric value. Got undefined."));
+        return NULL;
+    }
+    return AK_Json__Value_Number(&Parser->Values, AK_Json_Str__Substr(Stream->Str, Char.Index, Stream->StrIndex));
+}
+
+static ak_json_value* AK_Json__Parse_String_Value(ak_json__parser* Parser)
+{
+    ak_json__stream* Stream = &Parser->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    int HasEscapes;
+    if(!AK_Json__Scan_String(Stream, &HasEscapes))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting string value. Got undefined."));
+        return NULL;
+    }
+    return AK_Json__Value_String(&Parser->Values, Parser->Arena, AK_Json_Str__Substr(Stream->Str, Char.Index, Stream->StrIndex), HasEscapes);
+}
+
+static ak_json_value* AK_Json__Parse_Key(ak_json__parser* Parser)
+{
+    ak_json__stream* Stream = &Parser->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    int HasEscapes;
+    if(!AK_Json__Scan_String(Stream, &HasEscapes))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting string value. Got undefined."));
+        return NULL;
+    }
+    return AK_Json__Value_Key(&Parser->Values, Parser->Arena, Parser->Keys, AK_Json_Str__Substr(Stream->Str, Char.Index, Stream->StrIndex), HasEscapes);
+}
+
+static ak_json_value* AK_Json__Parse_Array_Value(ak_json__parser* Parser)
+{
+    ak_json__stream* Stream = &Parser->Stream;
+    ak_json__char StartChar = AK_Json__Stream_Consume_Char(Stream);
+    AK_JSON_ASSERT(StartChar.Char == '[');
+    
+    ak_json_u64 Base = Parser->Values.Count;
+    
+    AK_Json__Stream_Eat_Whitespace(Stream);
+    if(AK_Json__Stream_Is_Valid(Stream) && AK_Json__Stream_Peek_Char(Stream).Char == ']')
+    {
+        AK_Json__Stream_Increment(Stream);
+        return AK_Json__Value_Stack_Pop_Array(&Parser->Values, Parser->Arena, Base);
+    }
+    
+    while(AK_Json__Stream_Is_Valid(Stream))
+    {
+        if(!AK_Json__Parse_Generic(Parser)) return NULL;
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        ak_json__char Char = AK_Json__Stream_Consume_Char(Stream);
+        if(Char.Char == ']')
+            return AK_Json__Value_Stack_Pop_Array(&Parser->Values, Parser->Arena, Base);
+        
+        if(Char.Char != ',')
+        {
+            AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, Char, AK_Json_Str("Error parsing array. Expected , or ] characters."));
+            return NULL;
+        }
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+    }
+    
+    AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, StartChar, AK_Json_Str("Error parsing array. Expected , or ] characters. Got EOF."));
+    return NULL;
+}
+
+static ak_json_value* AK_Json__Parse_Object_Value(ak_json__parser* Parser)
+{
+    ak_json__stream* Stream = &Parser->Stream;
+    ak_json__char StartChar = AK_Json__Stream_Consume_Char(Stream);
+    AK_JSON_ASSERT(StartChar.Char == '{');
+    
+    ak_json_u64 Base = Parser->Values.Count;
+    
+    AK_Json__Stream_Eat_Whitespace(Stream);
+    if(AK_Json__Stream_Is_Valid(Stream) && AK_Json__Stream_Peek_Char(Stream).Char == '}')
+    {
+        AK_Json__Stream_Increment(Stream);
+        return AK_Json__Value_Stack_Pop_Object(&Parser->Values, Parser->Arena, Base);
+    }
+    
+    while(AK_Json__Stream_Is_Valid(Stream))
+    {
+        ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+        if(Char.Char != '"')
+        {
+            AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_Json_Str("Error parsing object. Expected a string key."));
+            return NULL;
+        }
+        if(!AK_Json__Parse_Key(Parser)) return NULL;
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        Char = AK_Json__Stream_Consume_Char(Stream);
+        if(Char.Char != ':')
+        {
+            AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_Json_Str("Error parsing object. Expected : after key."));
+            return NULL;
+        }
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        if(!AK_Json__Parse_Generic(Parser)) return NULL;
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        Char = AK_Json__Stream_Consume_Char(Stream);
+        if(Char.Char == '}')
+            return AK_Json__Value_Stack_Pop_Object(&Parser->Values, Parser->Arena, Base);
+        
+        if(Char.Char != ',')
+        {
+            AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_Json_Str("Error parsing object. Expected , or } characters."));
+            return NULL;
+        }
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+    }
+    
+    AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, StartChar, AK_Json_Str("Error parsing object. Expected , or } characters. Got EOF."));
+    return NULL;
+}
+
+static ak_json_value* AK_Json__Parse_Generic(ak_json__parser* Parser)
+{
+    ak_json__stream* Stream = &Parser->Stream;
+    AK_JSON_ASSERT(AK_Json__Stream_Is_Valid(Stream));
+    
+    ak_json_value* Result = NULL;
+    switch(AK_Json__Stream_Peek_Char(Stream).Char)
+    {
+        case 'n':
+        {
+            Result = AK_Json__Parse_Null_Value(Parser);
+        } break;
+        
+        case 't':
+        case 'f':
+        {
+            Result = AK_Json__Parse_Boolean_Value(Parser);
+        } break;
+        
+        case '"':
+        {
+            Result = AK_Json__Parse_String_Value(Parser);
+        } break;
+        
+        case '[':
+        case '{':
+        {
+            ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+            if(Parser->Depth == AK_JSON_MAX_DEPTH)
+            {
+                AK_Json__Error_Log(Stream->Str, Char.Char == '[' ? AK_JSON_ERROR_CODE_ARRAY_PARSING : AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_JSON__INTERNAL_ERROR_MAX_DEPTH);
+                break;
+            }
+            
+            Parser->Depth++;
+            Result = Char.Char == '[' ? AK_Json__Parse_Array_Value(Parser) : AK_Json__Parse_Object_Value(Parser);
+            Parser->Depth--;
+        } break;
+        
+        default:
+        {
+            Result = AK_Json__Parse_Number_Value(Parser);
+        } break;
+    }
+    
+    return Result;
+}
+
+#endif
+
+//NOTE(EVERYONE): Values and keys go into Arena, while scratch memory always comes from the context. Parsing 
+//into any other arena than the context's gets a key table that starts empty, so it never hands out keys that 
+//live somewhere else
+static ak_json_value* AK_Json__Parse(ak_json_context* Context, ak_json__arena* Arena, ak_json_str Str)
+{
+    ak_json__key_table* Keys = &Context->Keys;
+    if(Arena != Context->Arena)
+    {
+        Keys = &Context->DocumentKeys;
+        AK_Json__Key_Table_Clear(Keys);
+        Keys->Arena = Arena;
+    }
+    
+#ifdef AK_JSON_TWO_PASS_PARSER
+    //NOTE(EVERYONE): Minified json averages a token every few bytes, so start around there and grow 
+    ak_json__tokenizer Tokenizer;
+    Tokenizer.Depth = 0;
+    Tokenizer.Tape = Context->Tape;
+    Tokenizer.Tape.Count = 0;
+    int Tokenized = AK_Json__Token_Tape_Reserve(&Tokenizer.Tape, Str.Length/4 + 16) && AK_Json__Tokenize(&Tokenizer, Str);
+    Context->Tape = Tokenizer.Tape;
+    if(!Tokenized) return NULL;
+    
+    ak_json__parser Parser;
+    Parser.Arena      = Arena;
+    Parser.Str        = Str;
+    Parser.Tape       = &Context->Tape;
+    Parser.TapeIndex  = 0;
+    Parser.Depth      = 0;
+    Parser.Values     = Context->Values;
+    Parser.Values.Count = 0;
+    Parser.Keys = Keys;
+    
+    ak_json_value* RootValue = AK_Json__Parse_Generic(&Parser);
+    if(RootValue) RootValue = AK_Json__Value_Stack_Pop_Root(&Parser.Values, Arena);
+    
+    Context->Values = Parser.Values;
+    return RootValue;
+#else
+    ak_json__parser Parser;
+    Parser.Arena      = Arena;
+    Parser.Stream     = AK_Json__Stream_Create(Str);
+    Parser.Depth      = 0;
+    Parser.Values = Context->Values;
+    Parser.Values.Count = 0;
+    Parser.Keys = Keys;
+    
+    ak_json_value* RootValue = NULL;
+    ak_json__stream* Stream = &Parser.Stream;
+    AK_Json__Stream_Eat_Whitespace(Stream);
+    if(AK_Json__Stream_Is_Valid(Stream))
+    {
+        RootValue = AK_Json__Parse_Generic(&Parser);
+        if(RootValue)
+        {
+            AK_Json__Stream_Eat_Whitespace(Stream);
+            if(AK_Json__Stream_Is_Valid(Stream))
+            {
+                ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+                AK_Json__Error_Log(Str, AK_JSON_ERROR_CODE_EXPECTED_END_OF_STREAM, Char, AK_JSON__INTERNAL_ERROR_EXPECTED_EOF);
+                RootValue = NULL;
+            }
+        }
+    }
+    if(RootValue) RootValue = AK_Json__Value_Stack_Pop_Root(&Parser.Values, Arena);
+    
+    Context->Values = Parser.Values;
+    return RootValue;
+#endif
+}
+
+AK_JSON_DEF ak_json_value* AK_Json_Parse(ak_json_context* Context, ak_json_str Str)
+{
+    return AK_Json__Parse(Context, Context->Arena, Str);
+}
+
+/****************
+*** Documents ***
+*****************/
+
+//NOTE(EVERYONE): A document owns an arena of its own with its values and its keys, so it can be freed without 
+//touching the context or any other document, and it stays valid when the context is reset or deleted. 
+//Blocks are sized after the input, so small documents stay small
+#define AK_JSON__DOCUMENT_MIN_BLOCK_SIZE 4096
+#define AK_JSON__DOCUMENT_MAX_BLOCK_SIZE (1024*1024)
+
+typedef struct ak_json_document
+{
+    ak_json__arena* Arena;
+    ak_json_value*  Root;
+} ak_json_document;
+
+AK_JSON_DEF ak_json_document* AK_Json_Parse_Document(ak_json_context* Context, ak_json_str Str)
+{
+    ak_json_u64 BlockSize = Str.Length+sizeof(ak_json_document);
+    if(BlockSize < AK_JSON__DOCUMENT_MIN_BLOCK_SIZE) BlockSize = AK_JSON__DOCUMENT_MIN_BLOCK_SIZE;
+    if(BlockSize > AK_JSON__DOCUMENT_MAX_BLOCK_SIZE) BlockSize = AK_JSON__DOCUMENT_MAX_BLOCK_SIZE;
+    if(Str.Length >= AK_JSON_PREPASS_MIN_SIZE)
+    {
+        ak_json_u64 Size = AK_Json__Prepass(Str);
+        if(Size) BlockSize = Size+AK_Json__Arena_Align(sizeof(ak_json_document));
+    }
+    
+    ak_json__arena* Arena = AK_Json__Arena_Create(Context->Arena->Allocator, BlockSize);
+    if(!Arena) return NULL;
+    
+    ak_json_document* Result = (ak_json_document*)AK_Json__Arena_Push(Arena, sizeof(ak_json_document));
+    Result->Arena = Arena;
+    Result->Root  = AK_Json__Parse(Context, Arena, Str);
+    if(!Result->Root)
+    {
+        AK_Json__Arena_Delete(Arena);
+        return NULL;
+    }
+    return Result;
+}
+
+AK_JSON_DEF ak_json_value* AK_Json_Document_Get_Root(ak_json_document* Document)
+{
+    return Document->Root;
+}
+
+AK_JSON_DEF void AK_Json_Document_Free(ak_json_document* Document)
+{
+    if(Document) AK_Json__Arena_Delete(Document->Arena);
+}
+
+/**************************
+*** Parsing Into Buffers ***
+***************************/
+
+//NOTE(EVERYONE): Parses into memory the caller owns and never calls an allocator. The buffer becomes an arena 
+//that can't grow, and the context, the keys and every scratch buffer are pushed onto it along with the DOM. 
+//When it runs out the parse fails with AK_JSON_ERROR_CODE_OUT_OF_MEMORY. Everything returned points into 
+//Buffer, so it stays valid for as long as the buffer does
+
+//NOTE(EVERYONE): Every value on the stack, keys included, takes at least one byte of input plus a separator, 
+//and every key at least its quotes, a colon and a value
+#define AK_JSON__MAX_VALUES_FOR_INPUT(length) ((length)/2+2)
+#define AK_JSON__MAX_KEYS_FOR_INPUT(length)   ((length)/4+1)
+
+//NOTE(EVERYONE): A token is at least one byte of input and takes at most two tape entries
+#define AK_JSON__MAX_TAPE_ENTRIES_FOR_INPUT(length) (2*(length)+16)
+
+AK_JSON_DEF ak_json_value* AK_Json_Parse_Into(void* Buffer, ak_json_u64 Capacity, ak_json_str Str)
+{
+    ak_json__arena* Arena = AK_Json__Arena_Create_From_Memory(Buffer, Capacity);
+    if(!Arena)
+    {
+        AK_Json__Set_Error(AK_JSON_ERROR_CODE_OUT_OF_MEMORY, AK_JSON__INTERNAL_ERROR_OUT_OF_MEMORY);
+        return NULL;
+    }
+    
+    ak_json_context* Context = (ak_json_context*)AK_Json__Arena_Push(Arena, sizeof(ak_json_context));
+    if(!Context) return NULL;
+    
+    ak_json_allocator Allocator = AK_Json__Get_Arena_Allocator(Arena);
+    AK_Json__Memory_Clear(Context, sizeof(ak_json_context));
+    Context->Arena = Arena;
+    Context->Keys.Allocator = Allocator;
+    Context->Keys.Arena = Arena;
+    AK_Json__Value_Stack_Create(&Context->Values, Allocator);
+#ifdef AK_JSON_TWO_PASS_PARSER
+    AK_Json__Token_Tape_Create(&Context->Tape, Allocator);
+#endif
+    
+    //NOTE(EVERYONE): Frees do nothing in the buffer, so scratch that doubled would leave every old copy behind. 
+    //Instead it is sized once for the worst case of this input and never grows
+    if(!AK_Json__Value_Stack_Reserve(&Context->Values, AK_JSON__MAX_VALUES_FOR_INPUT(Str.Length))) return NULL;
+    if(!AK_Json__Key_Table_Reserve(&Context->Keys, AK_JSON__MAX_KEYS_FOR_INPUT(Str.Length))) return NULL;
+#ifdef AK_JSON_TWO_PASS_PARSER
+    if(!AK_Json__Token_Tape_Reserve(&Context->Tape, AK_JSON__MAX_TAPE_ENTRIES_FOR_INPUT(Str.Length))) return NULL;
+#endif
+    
+    return AK_Json__Parse(Context, Arena, Str);
+}
+
+//NOTE(EVERYONE): The most memory AK_Json_Parse_Into can need for an input of Length bytes, whatever it 
+//contains. Each part is the worst case for its own input shape, so real documents use a lot less:
+//  -DOM: an array element is 2 bytes of input for a 16 byte value, and an object member is its key 
+//   length plus 4 bytes for a 24 byte key, up to 16 bytes of hash slots and at most two copies of the 
+//   key, so no byte of input makes more than 16 bytes
+//  -Scratch: the value stack, the key slots and the token tape are sized once from Length, exactly 
+//   like AK_Json_Parse_Into does
+AK_JSON_DEF ak_json_u64 AK_Json_Max_Memory_For_Input(ak_json_u64 Length)
+{
+    ak_json_u64 Result = AK_JSON__ARENA_ALIGNMENT + sizeof(ak_json__arena) + sizeof(ak_json__arena_block);
+    Result += AK_Json__Arena_Align(sizeof(ak_json_context));
+    
+    Result += 16*Length + 64;
+    Result += AK_Json__Arena_Align(AK_JSON__MAX_VALUES_FOR_INPUT(Length)*sizeof(ak_json_value));
+    Result += AK_Json__Arena_Align(AK_Json__Key_Table_Get_Slot_Count(AK_JSON__MAX_KEYS_FOR_INPUT(Length))*sizeof(ak_json__interned_key*));
+    
+#ifdef AK_JSON_TWO_PASS_PARSER
+    Result += AK_Json__Arena_Align(AK_JSON__MAX_TAPE_ENTRIES_FOR_INPUT(Length)*sizeof(ak_json_u64));
+#endif
+    
+    return Result;
+}
+
+/***********
+*** Keys ***
+************/
+
+AK_JSON_DEF ak_json_str AK_Json_Key_Get_Name(ak_json_key* Key)
+{
+    return AK_Json__Interned_Key_Get_Str(AK_Json__Interned_Key_Get(Key->Name));
+}
+
+AK_JSON_DEF ak_json_value* AK_Json_Key_Get_Value(ak_json_key* Key)
+{
+    return &Key->Value;
+}
+
+/*************
+*** Values ***
+**************/
+AK_JSON_DEF ak_json_value_type AK_Json_Value_Get_Type(ak_json_value* Value)
+{
+    return AK_Json__Tag_Get_Type(Value->Tag);
+}
+
+AK_JSON_DEF ak_json_str AK_Json_Value_Get_String(ak_json_value* Value)
+{
+    AK_JSON_ASSERT(AK_Json_Value_Get_Type(Value) == AK_JSON_VALUE_TYPE_STRING);
+    return AK_Json_Str_Create(Value->String, AK_Json__Tag_Get_Payload(Value->Tag));
+}
+
+AK_JSON_DEF int AK_Json_Value_Get_Boolean(ak_json_value* Value)
+{
+    AK_JSON_ASSERT(AK_Json_Value_Get_Type(Value) == AK_JSON_VALUE_TYPE_BOOLEAN);
+    return (int)AK_Json__Tag_Get_Payload(Value->Tag);
+}
+
+AK_JSON_DEF double AK_Json_Value_Get_Number(ak_json_value* Value)
+{
+    AK_JSON_ASSERT(AK_Json_Value_Get_Type(Value) == AK_JSON_VALUE_TYPE_NUMBER);
+    switch(AK_Json__Tag_Get_Payload(Value->Tag))
+    {
+        case AK_JSON__NUMBER_TYPE_INT64: return (double)Value->Int64;
+        case AK_JSON__NUMBER_TYPE_UINT64: return (double)Value->Uint64;
+        default: return Value->Float;
+    }
+}
+
+AK_JSON_DEF int AK_Json_Value_Is_Integer(ak_json_value* Value)
+{
+    return AK_Json_Value_Get_Type(Value) == AK_JSON_VALUE_TYPE_NUMBER && AK_Json__Tag_Get_Payload(Value->Tag) != AK_JSON__NUMBER_TYPE_FLOAT;
+}
+
+AK_JSON_DEF ak_json_s64 AK_Json_Value_Get_Int64(ak_json_value* Value)
+{
+    AK_JSON_ASSERT(Value->Tag == AK_Json__Tag(AK_JSON_VALUE_TYPE_NUMBER, AK_JSON__NUMBER_TYPE_INT64));
+    return Value->Int64;
+}
+
+AK_JSON_DEF ak_json_u64 AK_Json_Value_Get_Uint64(ak_json_value* Value)
+{
+    AK_JSON_ASSERT(AK_Json_Value_Is_Integer(Value));
+    AK_JSON_ASSERT(AK_Json__Tag_Get_Payload(Value->Tag) == AK_JSON__NUMBER_TYPE_UINT64 || Value->Int64 >= 0);
+    return Value->Uint64;
+}
+
+AK_JSON_DEF ak_json_array* AK_Json_Value_Get_Array(ak_json_value* Value)
+{
+    AK_JSON_ASSERT(AK_Json_Value_Get_Type(Value) == AK_JSON_VALUE_TYPE_ARRAY);
+    return (ak_json_array*)Value;
+}
+
+AK_JSON_DEF ak_json_object* AK_Json_Value_Get_Object(ak_json_value* Value)
+{
+    AK_JSON_ASSERT(AK_Json_Value_Get_Type(Value) == AK_JSON_VALUE_TYPE_OBJECT);
+    return (ak_json_object*)Value;
+}
+
+/*************
+*** Arrays ***
+**************/
+
+AK_JSON_DEF unsigned int AK_Json_Array_Get_Length(ak_json_array* Array)
+{
+    return (unsigned int)AK_Json__Tag_Get_Payload(Array->Tag);
+}
+
+AK_JSON_DEF ak_json_value* AK_Json_Array_Get_Value(ak_json_array* Array, unsigned int Index)
+{
+    AK_JSON_ASSERT(Index < AK_Json_Array_Get_Length(Array));
+    return Array->Values + Index;
+}
+
+/**************
+*** Objects ***
+***************/
+
+AK_JSON_DEF unsigned int AK_Json_Object_Get_Key_Count(ak_json_object* Object)
+{
+    return AK_Json__Object_Get_Count(Object);
+}
+
+AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key_By_Index(ak_json_object* Object, unsigned int Index)
+{
+    AK_JSON_ASSERT(Index < AK_Json__Object_Get_Count(Object));
+    return Object->Keys + Index;
+}
+
+//NOTE(EVERYONE): Keys that came out of this context compare by pointer. Otherwise the length and the stored 
+//hash rule out almost every mismatch before the bytes are compared
+static int AK_Json__Key_Equal(const ak_json_u8* Name, ak_json_str Key, ak_json_u64 Hash)
+{
+    if(Name == Key.Str) return 1;
+    ak_json__interned_key* Interned = AK_Json__Interned_Key_Get(Name);
+    return Interned->Length == Key.Length && Interned->Hash == Hash && AK_Json__Memory_Equal(Name, Key.Str, Key.Length);
+}
+
+AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key(ak_json_object* Object, ak_json_str Key)
+{
+    unsigned int Count = AK_Json__Object_Get_Count(Object);
+    if(AK_Json__Object_Get_Slot_Count(Count)) return AK_Json_Object_Get_Key_Hashed(Object, Key, AK_Json_Hash_Str(Key));
+    
+    //NOTE(EVERYONE): Small objects are searched without hashing the key at all
+    unsigned int Index;
+    for(Index = 0; Index < Count; Index++)
+    {
+        const ak_json_u8* Name = Object->Keys[Index].Name;
+        if(Name == Key.Str) return Object->Keys + Index;
+        if(AK_Json__Interned_Key_Get(Name)->Length == Key.Length && AK_Json__Memory_Equal(Name, Key.Str, Key.Length))
+            return Object->Keys + Index;
+    }
+    return NULL;
+}
+
+//NOTE(EVERYONE): Hash has to be AK_Json_Hash_Str(Key)
+AK_JSON_DEF ak_json_key* AK_Json_Object_Get_Key_Hashed(ak_json_object* Object, ak_json_str Key, ak_json_u64 Hash)
+{
+    AK_JSON_ASSERT(Hash == AK_Json_Hash_Str(Key));
+    unsigned int Count = AK_Json__Object_Get_Count(Object);
+    ak_json_u32 SlotCount = AK_Json__Object_Get_Slot_Count(Count);
+    if(!SlotCount)
+    {
+        unsigned int Index;
+        for(Index = 0; Index < Count; Index++)
+        {
+            if(AK_Json__Key_Equal(Object->Keys[Index].Name, Key, Hash))
+                return Object->Keys + Index;
+        }
+        return NULL;
+    }
+    
+    ak_json_u32* Slots = AK_Json__Object_Get_Slots(Object);
+    ak_json_u32 SlotIndex = (ak_json_u32)Hash & (SlotCount-1);
+    while(Slots[SlotIndex])
+    {
+        ak_json_key* Result = Object->Keys + Slots[SlotIndex]-1;
+        if(AK_Json__Key_Equal(Result->Name, Key, Hash)) return Result;
+        SlotIndex = (SlotIndex+1) & (SlotCount-1);
+    }
+    return NULL;
+}
+
+/***********
+*** Tape ***
+************/
+
+//NOTE(EVERYONE): The tape is a second document format for scan heavy code that only reads a few fields 
+//and skips the rest. Every value is one or two 64 bit words in a single array, with its type in the top 
+//byte of the first word and a payload in the rest:
+//  null, boolean  one word, the payload is the boolean
+//  number         the payload is the number type and the next word holds the number
+//  string         the payload is the offset into the string buffer and the next word is the length
+//  array, object  the payload is the index of the matching end word and the next word is the count
+//  end            the payload is the index of the array or object word
+//Object entries are a key string followed by its value. Skipping any value, however big, is one jump
+#define AK_JSON__TAPE_TYPE_SHIFT   56
+#define AK_JSON__TAPE_PAYLOAD_MASK ((1ull << AK_JSON__TAPE_TYPE_SHIFT)-1)
+#define AK_JSON__TAPE_TYPE_END     (AK_JSON_VALUE_TYPE_OBJECT+1)
+
+typedef struct ak_json_tape
+{
+    ak_json_u64*      Words;
+    ak_json_u64       Count;
+    const ak_json_u8* Strings;
+} ak_json_tape;
+
+static ak_json_u64 AK_Json__Tape_Word(unsigned int Type, ak_json_u64 Payload)
+{
+    return ((ak_json_u64)Type << AK_JSON__TAPE_TYPE_SHIFT) | (Payload & AK_JSON__TAPE_PAYLOAD_MASK);
+}
+
+static unsigned int AK_Json__Tape_Word_Get_Type(ak_json_u64 Word)
+{
+    return (unsigned int)(Word >> AK_JSON__TAPE_TYPE_SHIFT);
+}
+
+static ak_json_u64 AK_Json__Tape_Word_Get_Payload(ak_json_u64 Word)
+{
+    return Word & AK_JSON__TAPE_PAYLOAD_MASK;
+}
+
+//NOTE(EVERYONE): Words and strings are built in two growable buffers and copied into the arena as one 
+//block once the whole input has been validated
+typedef struct ak_json__tape_builder
+{
+    ak_json_allocator Allocator;
+    ak_json__stream   Stream;
+    ak_json_u64       Depth;
+    ak_json_u64*      Words;
+    ak_json_u64       Count;
+    ak_json_u64       Capacity;
+    ak_json_u8*       Strings;
+    ak_json_u64       StringsUsed;
+    ak_json_u64       StringsCapacity;
+} ak_json__tape_builder;
+
+static int AK_Json__Tape_Builder_Create(ak_json__tape_builder* Builder, ak_json_allocator Allocator, ak_json_u64 StrLength)
+{
+    Builder->Allocator = Allocator;
+    Builder->Count = 0;
+    Builder->Capacity = StrLength/4 + 16;
+    Builder->Words = (ak_json_u64*)AK_Json__Allocate(&Builder->Allocator, Builder->Capacity*sizeof(ak_json_u64));
+    Builder->StringsUsed = 0;
+    Builder->StringsCapacity = StrLength/4 + 64;
+    Builder->Strings = (ak_json_u8*)AK_Json__Allocate(&Builder->Allocator, Builder->StringsCapacity);
+    return Builder->Words && Builder->Strings;
+}
+
+static void AK_Json__Tape_Builder_Delete(ak_json__tape_builder* Builder)
+{
+    AK_Json__Free(&Builder->Allocator, Builder->Words);
+    AK_Json__Free(&Builder->Allocator, Builder->Strings);
+    Builder->Words = NULL;
+    Builder->Strings = NULL;
+}
+
+static int AK_Json__Tape_Builder_Reserve_Words(ak_json__tape_builder* Builder, ak_json_u64 Count)
+{
+    if(Builder->Count+Count <= Builder->Capacity) return 1;
+    
+    ak_json_u64 Capacity = Builder->Capacity*2;
+    ak_json_u64* Words = (ak_json_u64*)AK_Json__Allocate(&Builder->Allocator, Capacity*sizeof(ak_json_u64));
+    if(!Words) return 0;
+    
+    AK_Json__Memory_Copy(Words, Builder->Words, Builder->Count*sizeof(ak_json_u64));
+    AK_Json__Free(&Builder->Allocator, Builder->Words);
+    Builder->Words = Words;
+    Builder->Capacity = Capacity;
+    return 1;
+}
+
+static ak_json_u8* AK_Json__Tape_Builder_Reserve_String(ak_json__tape_builder* Builder, ak_json_u64 Length)
+{
+    if(Builder->StringsUsed+Length > Builder->StringsCapacity)
+    {
+        ak_json_u64 Capacity = Builder->StringsCapacity*2;
+        while(Builder->StringsUsed+Length > Capacity) Capacity *= 2;
+        
+        ak_json_u8* Strings = (ak_json_u8*)AK_Json__Allocate(&Builder->Allocator, Capacity);
+        if(!Strings) return NULL;
+        
+        AK_Json__Memory_Copy(Strings, Builder->Strings, Builder->StringsUsed);
+        AK_Json__Free(&Builder->Allocator, Builder->Strings);
+        Builder->Strings = Strings;
+        Builder->StringsCapacity = Capacity;
+    }
+    return Builder->Strings + Builder->StringsUsed;
+}
+
+static int AK_Json__Tape_Add_Word(ak_json__tape_builder* Builder, unsigned int Type, ak_json_u64 Payload)
+{
+    if(!AK_Json__Tape_Builder_Reserve_Words(Builder, 1)) return 0;
+    Builder->Words[Builder->Count++] = AK_Json__Tape_Word(Type, Payload);
+    return 1;
+}
+
+static int AK_Json__Tape_Add_Words(ak_json__tape_builder* Builder, unsigned int Type, ak_json_u64 Payload, ak_json_u64 Value)
+{
+    if(!AK_Json__Tape_Builder_Reserve_Words(Builder, 2)) return 0;
+    Builder->Words[Builder->Count++] = AK_Json__Tape_Word(Type, Payload);
+    Builder->Words[Builder->Count++] = Value;
+    return 1;
+}
+
+static int AK_Json__Tape_Parse_Generic(ak_json__tape_builder* Builder);
+
+static int AK_Json__Tape_Parse_Null(ak_json__tape_builder* Builder)
+{
+    ak_json__stream* Stream = &Builder->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    if(!AK_Json__Scan_Null(Stream))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting null value. Got undefined."));
+        return 0;
+    }
+    return AK_Json__Tape_Add_Word(Builder, AK_JSON_VALUE_TYPE_NULL, 0);
+}
+
+static int AK_Json__Tape_Parse_Boolean(ak_json__tape_builder* Builder)
+{
+    ak_json__stream* Stream = &Builder->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    
+    int Boolean;
+    if(!AK_Json__Scan_Boolean(Stream, &Boolean))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting boolean value. Got undefined."));
+        return 0;
+    }
+    return AK_Json__Tape_Add_Word(Builder, AK_JSON_VALUE_TYPE_BOOLEAN, (ak_json_u64)Boolean);
+}
+
+static int AK_Json__Tape_Parse_Number(ak_json__tape_builder* Builder)
+{
+    ak_json__stream* Stream = &Builder->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    if(!AK_Json__Scan_Number(Stream))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting numeric value. Got undefined."));
+        return 0;
+    }
+    
+    ak_json_str NumberStr = AK_Json_Str__Substr(Stream->Str, Char.Index, Stream->StrIndex);
+    ak_json__number Number;
+    if(!AK_Json__Json_Str_To_Integer(NumberStr, &Number))
+    {
+        Number.Type  = AK_JSON__NUMBER_TYPE_FLOAT;
+        Number.Float = AK_Json__Json_Str_To_Number(NumberStr);
+    }
+    return AK_Json__Tape_Add_Words(Builder, AK_JSON_VALUE_TYPE_NUMBER, Number.Type, Number.Uint64);
+}
+
+//NOTE(EVERYONE): Strings are stored decoded and null terminated, keys included
+static int AK_Json__Tape_Parse_String(ak_json__tape_builder* Builder)
+{
+    ak_json__stream* Stream = &Builder->Stream;
+    ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+    int HasEscapes;
+    if(!AK_Json__Scan_String(Stream, &HasEscapes))
+    {
+        AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Char, AK_Json_Str("Expecting string value. Got undefined."));
+        return 0;
+    }
+    
+    //NOTE(EVERYONE): Remove quotes from string
+    ak_json_str JsonStr = AK_Json_Str__Substr(Stream->Str, Char.Index+1, Stream->StrIndex);
+    JsonStr.Length--;
     
-    if(Result) AK_Json__Stream_Eat_Whitespace(Stream);
-    return Result;
+    ak_json_u8* Buffer = AK_Json__Tape_Builder_Reserve_String(Builder, JsonStr.Length+1);
+    if(!Buffer) return 0;
+    
+    ak_json_u64 Length = JsonStr.Length;
+    if(HasEscapes) Length = AK_Json__Decode_Json_Str(Buffer, JsonStr);
+    else AK_Json__Memory_Copy(Buffer, JsonStr.Str, Length);
+    Buffer[Length] = 0;
+    
+    ak_json_u64 Offset = Builder->StringsUsed;
+    Builder->StringsUsed += Length+1;
+    return AK_Json__Tape_Add_Words(Builder, AK_JSON_VALUE_TYPE_STRING, Offset, Length);
 }
 
-static int AK_Json__Tokenize_Array(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+static int AK_Json__Tape_End_Container(ak_json__tape_builder* Builder, ak_json_u64 StartIndex, ak_json_u64 Count)
+{
+    ak_json_u64 EndIndex = Builder->Count;
+    if(!AK_Json__Tape_Add_Word(Builder, AK_JSON__TAPE_TYPE_END, StartIndex)) return 0;
+    
+    ak_json_u64* Start = Builder->Words + StartIndex;
+    Start[0] = AK_Json__Tape_Word(AK_Json__Tape_Word_Get_Type(Start[0]), EndIndex);
+    Start[1] = Count;
+    return 1;
+}
+
+static int AK_Json__Tape_Parse_Array(ak_json__tape_builder* Builder)
 {
+    ak_json__stream* Stream = &Builder->Stream;
     ak_json__char StartChar = AK_Json__Stream_Consume_Char(Stream);
     AK_JSON_ASSERT(StartChar.Char == '[');
     
-    ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_ARRAY_START, StartChar);
-    Token->Length = 1;
+    ak_json_u64 StartIndex = Builder->Count;
+    if(!AK_Json__Tape_Add_Words(Builder, AK_JSON_VALUE_TYPE_ARRAY, 0, 0)) return 0;
+    
+    AK_Json__Stream_Eat_Whitespace(Stream);
+    if(AK_Json__Stream_Is_Valid(Stream) && AK_Json__Stream_Peek_Char(Stream).Char == ']')
+    {
+        AK_Json__Stream_Increment(Stream);
+        return AK_Json__Tape_End_Container(Builder, StartIndex, 0);
+    }
     
+    ak_json_u64 Count = 0;
     while(AK_Json__Stream_Is_Valid(Stream))
     {
+        if(!AK_Json__Tape_Parse_Generic(Builder)) return 0;
+        Count++;
+        
         AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
         
-        ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+        ak_json__char Char = AK_Json__Stream_Consume_Char(Stream);
         if(Char.Char == ']')
+            return AK_Json__Tape_End_Container(Builder, StartIndex, Count);
+        
+        if(Char.Char != ',')
         {
-            Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_ARRAY_END, Char);
-            Token->Length = 1;
-            AK_Json__Stream_Increment(Stream);
-            return 1;
-        }
-        else if(Char.Char == ',')
-        {
-            Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_COMMA, Char);
-            Token->Length = 1;
-            AK_Json__Stream_Increment(Stream);
-        }
-        else
-        {
-            if(!AK_Json__Tokenize_Generic(Tokenizer, Stream))
-                return 0;
+            AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, Char, AK_Json_Str("Error parsing array. Expected , or ] characters."));
+            return 0;
         }
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
     }
     
-    //NOTE(EVERYONE): Allocate an undefined token and handle the error later
-    Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_UNDEFINED, StartChar);
-    Token->Length = 0;
-    
-    return 1;
+    AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, StartChar, AK_Json_Str("Error parsing array. Expected , or ] characters. Got EOF."));
+    return 0;
 }
 
-static int AK_Json__Tokenize_Object(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+static int AK_Json__Tape_Parse_Object(ak_json__tape_builder* Builder)
 {
+    ak_json__stream* Stream = &Builder->Stream;
     ak_json__char StartChar = AK_Json__Stream_Consume_Char(Stream);
     AK_JSON_ASSERT(StartChar.Char == '{');
     
-    ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_OBJECT_START, StartChar);
-    Token->Length = 1;
+    ak_json_u64 StartIndex = Builder->Count;
+    if(!AK_Json__Tape_Add_Words(Builder, AK_JSON_VALUE_TYPE_OBJECT, 0, 0)) return 0;
+    
+    AK_Json__Stream_Eat_Whitespace(Stream);
+    if(AK_Json__Stream_Is_Valid(Stream) && AK_Json__Stream_Peek_Char(Stream).Char == '}')
+    {
+        AK_Json__Stream_Increment(Stream);
+        return AK_Json__Tape_End_Container(Builder, StartIndex, 0);
+    }
     
+    ak_json_u64 Count = 0;
     while(AK_Json__Stream_Is_Valid(Stream))
     {
-        AK_Json__Stream_Eat_Whitespace(Stream);
-        
         ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
-        
-        if(Char.Char == '}')
-        {
-            ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_OBJECT_END, Char);
-            Token->Length = 1;
-            AK_Json__Stream_Increment(Stream);
-            return 1;
-        }
-        else if(Char.Char == ':')
+        if(Char.Char != '"')
         {
-            ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_OBJECT_KEY_DELIMITER, Char);
-            Token->Length = 1;
-            AK_Json__Stream_Increment(Stream);
+            AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_Json_Str("Error parsing object. Expected a string key."));
+            return 0;
         }
-        else if(Char.Char == ',')
+        if(!AK_Json__Tape_Parse_String(Builder)) return 0;
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        Char = AK_Json__Stream_Consume_Char(Stream);
+        if(Char.Char != ':')
         {
-            ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_COMMA, Char);
-            Token->Length = 1;
-            AK_Json__Stream_Increment(Stream);
+            AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_Json_Str("Error parsing object. Expected : after key."));
+            return 0;
         }
-        else
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        if(!AK_Json__Tape_Parse_Generic(Builder)) return 0;
+        Count++;
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
+        if(!AK_Json__Stream_Is_Valid(Stream)) break;
+        
+        Char = AK_Json__Stream_Consume_Char(Stream);
+        if(Char.Char == '}')
+            return AK_Json__Tape_End_Container(Builder, StartIndex, Count);
+        
+        if(Char.Char != ',')
         {
-            if(!AK_Json__Tokenize_Generic(Tokenizer, Stream))
-                return 0;
+            AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_Json_Str("Error parsing object. Expected , or } characters."));
+            return 0;
         }
+        
+        AK_Json__Stream_Eat_Whitespace(Stream);
     }
     
-    //NOTE(EVERYONE): Allocate an undefined token and handle the error later
-    Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_UNDEFINED, StartChar);
-    Token->Length = 0;
-    
-    return 1;
+    AK_Json__Error_Log(Stream->Str, AK_JSON_ERROR_CODE_OBJECT_PARSING, StartChar, AK_Json_Str("Error parsing object. Expected , or } characters. Got EOF."));
+    return 0;
 }
 
-static int AK_Json__Tokenize_Generic(ak_json__tokenizer* Tokenizer, ak_json__stream* Stream)
+static int AK_Json__Tape_Parse_Generic(ak_json__tape_builder* Builder)
 {
+    ak_json__stream* Stream = &Builder->Stream;
+    AK_JSON_ASSERT(AK_Json__Stream_Is_Valid(Stream));
+    
     int Result = 0;
-    if(AK_Json__Stream_Is_Valid(Stream))
+    switch(AK_Json__Stream_Peek_Char(Stream).Char)
     {
-        ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
-        switch(Char.Char)
+        case 'n':
         {
-            case '{':
-            {
-                Result = AK_Json__Tokenize_Object(Tokenizer, Stream);
-            } break;
-            
-            case '[':
+            Result = AK_Json__Tape_Parse_Null(Builder);
+        } break;
+        
+        case 't':
+        case 'f':
+        {
+            Result = AK_Json__Tape_Parse_Boolean(Builder);
+        } break;
+        
+        case '"':
+        {
+            Result = AK_Json__Tape_Parse_String(Builder);
+        } break;
+        
+        case '[':
+        case '{':
+        {
+            ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+            if(Builder->Depth == AK_JSON_MAX_DEPTH)
             {
-                Result = AK_Json__Tokenize_Array(Tokenizer, Stream);
-            } break;
+                AK_Json__Error_Log(Stream->Str, Char.Char == '[' ? AK_JSON_ERROR_CODE_ARRAY_PARSING : AK_JSON_ERROR_CODE_OBJECT_PARSING, Char, AK_JSON__INTERNAL_ERROR_MAX_DEPTH);
+                break;
+            }
             
-            default:
-            {
-                Result = AK_Json__Tokenize_Value(Tokenizer, Stream);
-            } break;
-        }
+            Builder->Depth++;
+            Result = Char.Char == '[' ? AK_Json__Tape_Parse_Array(Builder) : AK_Json__Tape_Parse_Object(Builder);
+            Builder->Depth--;
+        } break;
+        
+        default:
+        {
+            Result = AK_Json__Tape_Parse_Number(Builder);
+        } break;
     }
     
     return Result;
 }
 
-static int AK_Json__Tokenize(ak_json__tokenizer* Tokenizer, ak_json_str Str)
+AK_JSON_DEF ak_json_tape* AK_Json_Parse_Tape(ak_json_context* Context, ak_json_str Str)
 {
-    ak_json__stream Stream = AK_Json__Stream_Create(Str);
-    AK_Json__Stream_Eat_Whitespace(&Stream);
+    ak_json__tape_builder Builder;
+    if(!AK_Json__Tape_Builder_Create(&Builder, Context->Arena->Allocator, Str.Length))
+    {
+        AK_Json__Tape_Builder_Delete(&Builder);
+        return NULL;
+    }
     
-    int Result = AK_Json__Tokenize_Generic(Tokenizer, &Stream);
+    Builder.Stream = AK_Json__Stream_Create(Str);
+    Builder.Depth  = 0;
     
-    if(Result)
+    int Parsed = 0;
+    ak_json__stream* Stream = &Builder.Stream;
+    AK_Json__Stream_Eat_Whitespace(Stream);
+    if(AK_Json__Stream_Is_Valid(Stream))
     {
-        AK_Json__Stream_Eat_Whitespace(&Stream);
-        if(AK_Json__Stream_Is_Valid(&Stream))
+        Parsed = AK_Json__Tape_Parse_Generic(&Builder);
+        if(Parsed)
         {
-            //NOTE(EVERYONE): There shouldn't be anymore remaining items here
-            //TODO(JJ): Log error
-            ak_json__char Char = AK_Json__Stream_Peek_Char(&Stream);
-            AK_Json__Error_Log(Tokenizer->ErrorArena, Str, AK_JSON_ERROR_CODE_EXPECTED_END_OF_STREAM, Char, AK_JSON__INTERNAL_ERROR_EXPECTED_EOF);
-            return 0;
+            AK_Json__Stream_Eat_Whitespace(Stream);
+            if(AK_Json__Stream_Is_Valid(Stream))
+            {
+                ak_json__char Char = AK_Json__Stream_Peek_Char(Stream);
+                AK_Json__Error_Log(Str, AK_JSON_ERROR_CODE_EXPECTED_END_OF_STREAM, Char, AK_JSON__INTERNAL_ERROR_EXPECTED_EOF);
+                Parsed = 0;
+            }
         }
-        
-        ak_json__char Char;
-        AK_Json__Memory_Clear(&Char, sizeof(ak_json__char));
-        ak_json__token* Token = AK_Json__Tokenizer_Allocate_Token(Tokenizer, AK_JSON__TOKEN_TYPE_TERMINATOR, Char);
     }
     
-    return Result;
+    ak_json_tape* Tape = NULL;
+    if(Parsed)
+    {
+        ak_json_u64 WordsSize = Builder.Count*sizeof(ak_json_u64);
+        Tape = (ak_json_tape*)AK_Json__Arena_Push(Context->Arena, sizeof(ak_json_tape)+WordsSize+Builder.StringsUsed);
+        if(Tape)
+        {
+            Tape->Words   = (ak_json_u64*)(Tape+1);
+            Tape->Count   = Builder.Count;
+            Tape->Strings = (const ak_json_u8*)Tape->Words + WordsSize;
+            AK_Json__Memory_Copy(Tape->Words, Builder.Words, WordsSize);
+            AK_Json__Memory_Copy((ak_json_u8*)Tape->Strings, Builder.Strings, Builder.StringsUsed);
+        }
+    }
+    
+    AK_Json__Tape_Builder_Delete(&Builder);
+    return Tape;
 }
 
-#undef AK_Json__Return_Undefined
-
-typedef enum ak_json__object_parsing_state
+AK_JSON_DEF ak_json_cursor AK_Json_Tape_Get_Root(ak_json_tape* Tape)
 {
-    AK_JSON__OBJECT_PARSING_STATE_INITIAL,
-    AK_JSON__OBJECT_PARSING_STATE_KEY,
-    AK_JSON__OBJECT_PARSING_STATE_DELIMTER,
-    AK_JSON__OBJECT_PARSING_STATE_VALUE,
-    AK_JSON__OBJECT_PARSING_STATE_COMMA
-} ak_json__object_parsing_state;
+    ak_json_cursor Result;
+    Result.Tape  = Tape;
+    Result.Index = 0;
+    return Result;
+}
 
-typedef struct ak_json__tmp_key
-{
-    ak_json_str                Key;
-    struct ak_json__tmp_value* TmpValue;
-    struct ak_json__tmp_key*   Next;
-} ak_json__tmp_key;
+/**************
+*** Cursors ***
+***************/
 
-typedef struct ak_json__tmp_object
+static ak_json_u64 AK_Json__Cursor_Get_Word(ak_json_cursor Cursor)
 {
-    unsigned int             Count;
-    struct ak_json__tmp_key* First;
-    struct ak_json__tmp_key* Last;
-} ak_json__tmp_object;
+    AK_JSON_ASSERT(AK_Json_Cursor_Is_Valid(Cursor));
+    return Cursor.Tape->Words[Cursor.Index];
+}
 
-typedef struct ak_json__tmp_array
+static ak_json_cursor AK_Json__Cursor_Invalid()
 {
-    unsigned int               Count;
-    struct ak_json__tmp_value* First;
-    struct ak_json__tmp_value* Last;
-} ak_json__tmp_array;
+    ak_json_cursor Result;
+    Result.Tape  = NULL;
+    Result.Index = 0;
+    return Result;
+}
 
-typedef struct ak_json__tmp_value
+//NOTE(EVERYONE): A cursor is invalid past the last value of its array or object, past the root, or when 
+//it came from a lookup that found nothing
+AK_JSON_DEF int AK_Json_Cursor_Is_Valid(ak_json_cursor Cursor)
 {
-    ak_json_value_type Type;
-    union
-    {
-        ak_json_str    String;
-        int            Boolean;
-        double         Number;
-        ak_json__tmp_array  Array;
-        ak_json__tmp_object Object;
-    };
-    
-    struct ak_json__tmp_value* Next;
-} ak_json__tmp_value;
+    if(!Cursor.Tape || Cursor.Index >= Cursor.Tape->Count) return 0;
+    return AK_Json__Tape_Word_Get_Type(Cursor.Tape->Words[Cursor.Index]) != AK_JSON__TAPE_TYPE_END;
+}
 
-typedef struct ak_json__parser
+AK_JSON_DEF ak_json_value_type AK_Json_Cursor_Get_Type(ak_json_cursor Cursor)
 {
-    ak_json__arena*     Arena;
-    ak_json__arena*     ErrorArena;
-    ak_json_str         Str;
-    ak_json__token_list Tokens;
-    ak_json__token*     CurrentToken;
-} ak_json__parser;
+    return (ak_json_value_type)AK_Json__Tape_Word_Get_Type(AK_Json__Cursor_Get_Word(Cursor));
+}
 
-static ak_json__tmp_value* AK_Json__Parse_Generic(ak_json__parser* Parser);
+AK_JSON_DEF ak_json_str AK_Json_Cursor_Get_String(ak_json_cursor Cursor)
+{
+    ak_json_u64 Word = AK_Json__Cursor_Get_Word(Cursor);
+    AK_JSON_ASSERT(AK_Json__Tape_Word_Get_Type(Word) == AK_JSON_VALUE_TYPE_STRING);
+    return AK_Json_Str_Create(Cursor.Tape->Strings + AK_Json__Tape_Word_Get_Payload(Word), Cursor.Tape->Words[Cursor.Index+1]);
+}
 
-static ak_json__token* AK_Json__Parser_Peek_Token(ak_json__parser* Parser)
+AK_JSON_DEF int AK_Json_Cursor_Get_Boolean(ak_json_cursor Cursor)
 {
-    return Parser->CurrentToken;
+    ak_json_u64 Word = AK_Json__Cursor_Get_Word(Cursor);
+    AK_JSON_ASSERT(AK_Json__Tape_Word_Get_Type(Word) == AK_JSON_VALUE_TYPE_BOOLEAN);
+    return (int)AK_Json__Tape_Word_Get_Payload(Word);
 }
 
-static void AK_Json__Parser_Increment_Token(ak_json__parser* Parser)
+AK_JSON_DEF double AK_Json_Cursor_Get_Number(ak_json_cursor Cursor)
 {
-    Parser->CurrentToken = Parser->CurrentToken->Next;
+    ak_json_u64 Word = AK_Json__Cursor_Get_Word(Cursor);
+    AK_JSON_ASSERT(AK_Json__Tape_Word_Get_Type(Word) == AK_JSON_VALUE_TYPE_NUMBER);
+    
+    ak_json__number Number;
+    Number.Uint64 = Cursor.Tape->Words[Cursor.Index+1];
+    switch(AK_Json__Tape_Word_Get_Payload(Word))
+    {
+        case AK_JSON__NUMBER_TYPE_INT64: return (double)Number.Int64;
+        case AK_JSON__NUMBER_TYPE_UINT64: return (double)Number.Uint64;
+        default: return Number.Float;
+    }
 }
 
-static ak_json__token* AK_Json__Parser_Consume_Token(ak_json__parser* Parser)
+AK_JSON_DEF int AK_Json_Cursor_Is_Integer(ak_json_cursor Cursor)
 {
-    ak_json__token* Result = AK_Json__Parser_Peek_Token(Parser);
-    AK_Json__Parser_Increment_Token(Parser);
-    return Result;
+    ak_json_u64 Word = AK_Json__Cursor_Get_Word(Cursor);
+    return AK_Json__Tape_Word_Get_Type(Word) == AK_JSON_VALUE_TYPE_NUMBER && AK_Json__Tape_Word_Get_Payload(Word) != AK_JSON__NUMBER_TYPE_FLOAT;
 }
 
-static ak_json__tmp_value* AK_Json__Parse_Null_Value(ak_json__parser* Parser)
+AK_JSON_DEF ak_json_s64 AK_Json_Cursor_Get_Int64(ak_json_cursor Cursor)
 {
-    ak_json__token* Token = AK_Json__Parser_Consume_Token(Parser);
-    AK_JSON_ASSERT(Token->Type == AK_JSON__TOKEN_TYPE_NULL);
-    ak_json__tmp_value* Value = (ak_json__tmp_value*)AK_Json__Arena_Push(Parser->Arena, sizeof(ak_json__tmp_value));
-    Value->Type = AK_JSON_VALUE_TYPE_NULL;
-    return Value;
+    AK_JSON_ASSERT(AK_Json__Cursor_Get_Word(Cursor) == AK_Json__Tape_Word(AK_JSON_VALUE_TYPE_NUMBER, AK_JSON__NUMBER_TYPE_INT64));
+    return (ak_json_s64)Cursor.Tape->Words[Cursor.Index+1];
 }
 
-static ak_json__tmp_value* AK_Json__Parse_Boolean_Value(ak_json__parser* Parser)
+AK_JSON_DEF ak_json_u64 AK_Json_Cursor_Get_Uint64(ak_json_cursor Cursor)
 {
-    ak_json__token* Token = AK_Json__Parser_Consume_Token(Parser);
-    AK_JSON_ASSERT(Token->Type == AK_JSON__TOKEN_TYPE_BOOLEAN);
-    ak_json_str TokenStr = AK_Json__Token_Get_Str(Parser->Str, Token);
-    
-    int Boolean = AK_Json_Str__Equal(TokenStr, AK_Json_Str("true")) ? 1 : 0;
-    ak_json__tmp_value* Value = (ak_json__tmp_value*)AK_Json__Arena_Push(Parser->Arena, sizeof(ak_json__tmp_value));
-    Value->Type = AK_JSON_VALUE_TYPE_BOOLEAN;
-    Value->Boolean = Boolean;
+    AK_JSON_ASSERT(AK_Json_Cursor_Is_Integer(Cursor));
+    ak_json_u64 Value = Cursor.Tape->Words[Cursor.Index+1];
+    AK_JSON_ASSERT(AK_Json__Tape_Word_Get_Payload(AK_Json__Cursor_Get_Word(Cursor)) == AK_JSON__NUMBER_TYPE_UINT64 || (ak_json_s64)Value >= 0);
     return Value;
 }
 
-static ak_json__tmp_value* AK_Json__Parse_Number_Value(ak_json__parser* Parser)
+//NOTE(EVERYONE): The number of elements of an array or the number of keys of an object
+AK_JSON_DEF unsigned int AK_Json_Cursor_Get_Length(ak_json_cursor Cursor)
 {
-    ak_json__token* Token = AK_Json__Parser_Consume_Token(Parser);
-    AK_JSON_ASSERT(Token->Type == AK_JSON__TOKEN_TYPE_NUMBER);
-    
-    ak_json_str TokenStr = AK_Json__Token_Get_Str(Parser->Str, Token);
-    
-    ak_json__tmp_value* Value = (ak_json__tmp_value*)AK_Json__Arena_Push(Parser->Arena, sizeof(ak_json__tmp_value));
-    Value->Type = AK_JSON_VALUE_TYPE_NUMBER;
-    Value->Number = AK_JSON_ATOF((const char*)TokenStr.Str);
-    return Value;
+    AK_JSON_ASSERT(AK_Json_Cursor_Get_Type(Cursor) == AK_JSON_VALUE_TYPE_ARRAY || AK_Json_Cursor_Get_Type(Cursor) == AK_JSON_VALUE_TYPE_OBJECT);
+    return (unsigned int)Cursor.Tape->Words[Cursor.Index+1];
 }
 
-static ak_json__tmp_value* AK_Json__Parse_String_Value(ak_json__parser* Parser)
+//NOTE(EVERYONE): The first element of an array, or the first key of an object. Walking an object with 
+//AK_Json_Cursor_Get_Next alternates between keys and their values
+AK_JSON_DEF ak_json_cursor AK_Json_Cursor_Get_First(ak_json_cursor Cursor)
 {
-    ak_json__token* Token = AK_Json__Parser_Consume_Token(Parser);
-    AK_JSON_ASSERT(Token->Type == AK_JSON__TOKEN_TYPE_STRING);
-    
-    ak_json_str TokenStr = AK_Json__Token_Get_Str(Parser->Str, Token);
-    
-    //NOTE(EVERYONE): Remove quotes from string
-    TokenStr.Str = TokenStr.Str+1;
-    TokenStr.Length -= 2;
-    
-    ak_json__tmp_value* Value = (ak_json__tmp_value*)AK_Json__Arena_Push(Parser->Arena, sizeof(ak_json__tmp_value));
-    Value->Type = AK_JSON_VALUE_TYPE_STRING;
-    Value->String = AK_Json__Json_Str_To_UTF8(Parser->Arena, TokenStr);
-    
-    return Value;
+    AK_JSON_ASSERT(AK_Json_Cursor_Get_Type(Cursor) == AK_JSON_VALUE_TYPE_ARRAY || AK_Json_Cursor_Get_Type(Cursor) == AK_JSON_VALUE_TYPE_OBJECT);
+    Cursor.Index += 2;
+    return Cursor;
 }
 
-static ak_json__tmp_value* AK_Json__Parse_Array_Value(ak_json__parser* Parser)
+AK_JSON_DEF ak_json_cursor AK_Json_Cursor_Get_Next(ak_json_cursor Cursor)
 {
-    ak_json__token* StartToken = AK_Json__Parser_Consume_Token(Parser);
-    AK_JSON_ASSERT(StartToken->Type == AK_JSON__TOKEN_TYPE_ARRAY_START);
-    
-    int HasFinishedCorrectly = 0;
-    
-    ak_json__tmp_value* Value = (ak_json__tmp_value*)AK_Json__Arena_Push(Parser->Arena, sizeof(ak_json__tmp_value));
-    Value->Type = AK_JSON_VALUE_TYPE_ARRAY;
-    ak_json__tmp_array* Array = &Value->Array;
-    Array->Count = 0;
-    Array->First = Array->Last = NULL;
-    
-    int NeedsValue = 1;
-    int CanFinish = 1;
-    ak_json__token* Token = AK_Json__Parser_Peek_Token(Parser);
-    
-    while(Token && !HasFinishedCorrectly)
+    ak_json_u64 Word = AK_Json__Cursor_Get_Word(Cursor);
+    switch(AK_Json__Tape_Word_Get_Type(Word))
     {
-        switch(Token->Type)
-        {
-            case AK_JSON__TOKEN_TYPE_ARRAY_END:
-            {
-                if(!CanFinish) 
-                {
-                    //TODO(JJ): Diagnostic and error logging
-                    return NULL;
-                }
-                HasFinishedCorrectly = 1;
-                AK_Json__Parser_Increment_Token(Parser);
-            } break;
-            
-            case AK_JSON__TOKEN_TYPE_COMMA:
-            {
-                if(NeedsValue)
-                {
-                    //TODO(JJ): Error logging
-                    return NULL;
-                }
-                
-                AK_Json__Parser_Increment_Token(Parser);
-                NeedsValue = 1;
-                CanFinish = 0;
-            } break;
-            
-            default:
-            {
-                if(!NeedsValue)
-                {
-                    //TODO(JJ): Error logging
-                    return NULL;
-                }
-                
-                ak_json__tmp_value* Value = AK_Json__Parse_Generic(Parser);
-                
-                if(!Array->First) Array->First = Value;
-                else Array->Last->Next = Value;
-                Array->Last = Value;
-                
-                Array->Count++;
-                
-                NeedsValue = 0;
-                CanFinish = 1;
-            } break;
-        }
-        
-        Token = AK_Json__Parser_Peek_Token(Parser);
+        case AK_JSON_VALUE_TYPE_NUMBER:
+        case AK_JSON_VALUE_TYPE_STRING: Cursor.Index += 2; break;
+        case AK_JSON_VALUE_TYPE_ARRAY:
+        case AK_JSON_VALUE_TYPE_OBJECT: Cursor.Index = AK_Json__Tape_Word_Get_Payload(Word)+1; break;
+        default: Cursor.Index++; break;
     }
-    
-    if(!HasFinishedCorrectly)
+    return Cursor;
+}
+
+AK_JSON_DEF ak_json_cursor AK_Json_Cursor_Get_Value(ak_json_cursor Array, unsigned int Index)
+{
+    AK_JSON_ASSERT(Index < AK_Json_Cursor_Get_Length(Array));
+    ak_json_cursor Result = AK_Json_Cursor_Get_First(Array);
+    while(Index--) Result = AK_Json_Cursor_Get_Next(Result);
+    return Result;
+}
+
+//NOTE(EVERYONE): Returns the value of the first key named Key, skipping over the values of every other key
+AK_JSON_DEF ak_json_cursor AK_Json_Cursor_Get_Key(ak_json_cursor Object, ak_json_str Key)
+{
+    AK_JSON_ASSERT(AK_Json_Cursor_Get_Type(Object) == AK_JSON_VALUE_TYPE_OBJECT);
+    ak_json_cursor Name = AK_Json_Cursor_Get_First(Object);
+    while(AK_Json_Cursor_Is_Valid(Name))
     {
-        AK_Json__Error_Log(Parser->ErrorArena, Parser->Str, AK_JSON_ERROR_CODE_ARRAY_PARSING, StartToken->StartChar, AK_Json_Str("Error parsing array. Expected , or ] characters. Got EOF."));
-        return NULL;
+        ak_json_cursor Value = AK_Json_Cursor_Get_Next(Name);
+        if(AK_Json_Str__Equal(AK_Json_Cursor_Get_String(Name), Key)) return Value;
+        Name = AK_Json_Cursor_Get_Next(Value);
     }
-    
-    return Value;
+    return AK_Json__Cursor_Invalid();
+}
+
+/***********
+*** Lazy ***
+************/
+
+//NOTE(EVERYONE): Lazy values parse the input on demand. Moving to the next value only finds where the 
+//current one ends: scalars are scanned and arrays and objects are skipped by matching brackets, so skipped 
+//subtrees are never validated or decoded. Numbers and strings are converted when their getter is called. 
+//Errors are only found on the parts of the input that get touched, and are reported the usual way. The 
+//input has to outlive every lazy value that points into it
+static ak_json_lazy AK_Json__Lazy_Create(ak_json_context* Context, ak_json_str Str, ak_json_u64 Index, ak_json_value_type Parent, int IsKey)
+{
+    ak_json_lazy Result;
+    Result.Context = Context;
+    Result.Str     = Str;
+    Result.Index   = Index;
+    Result.Parent  = Parent;
+    Result.IsKey   = IsKey;
+    return Result;
+}
+
+static ak_json_lazy AK_Json__Lazy_Invalid()
+{
+    ak_json_str Str = {NULL, 0};
+    return AK_Json__Lazy_Create(NULL, Str, 0, AK_JSON_VALUE_TYPE_NULL, 0);
+}
+
+static ak_json__stream AK_Json__Lazy_Get_Stream(ak_json_lazy Lazy)
+{
+    ak_json__stream Stream = AK_Json__Stream_Create(Lazy.Str);
+    Stream.StrIndex = Lazy.Index;
+    return Stream;
+}
+
+static void AK_Json__Lazy_Error(ak_json_lazy Lazy, ak_json_error_code ErrorCode, ak_json_u64 Index, ak_json_str Message)
+{
+    ak_json__char Char;
+    Char.Index = Index < Lazy.Str.Length ? Index : Lazy.Str.Length-1;
+    Char.Char  = Lazy.Str.Str[Char.Index];
+    AK_Json__Error_Log(Lazy.Str, ErrorCode, Char, Message);
 }
 
-static ak_json__tmp_value* AK_Json__Parse_Object(ak_json__parser* Parser)
+//NOTE(EVERYONE): Only brackets outside of strings are counted, the string scan just steps over escapes
+static int AK_Json__Lazy_Skip_Container(ak_json__stream* Stream)
 {
-    ak_json__token* StartToken = AK_Json__Parser_Consume_Token(Parser);
-    AK_JSON_ASSERT(StartToken->Type == AK_JSON__TOKEN_TYPE_OBJECT_START);
-    
-    int HasFinishedCorrectly = 0;
-    
-    ak_json__tmp_value* Value = (ak_json__tmp_value*)AK_Json__Arena_Push(Parser->Arena, sizeof(ak_json__tmp_value));
-    Value->Type = AK_JSON_VALUE_TYPE_OBJECT;
-    
-    ak_json__tmp_object* Object = &Value->Object;
-    
-    ak_json__object_parsing_state ParsingState = AK_JSON__OBJECT_PARSING_STATE_INITIAL;
-    
-    ak_json__token* Token = AK_Json__Parser_Peek_Token(Parser);
-    while(Token && !HasFinishedCorrectly)
+    const ak_json_u8* Str = Stream->Str.Str;
+    ak_json_u64 Length = Stream->Str.Length;
+    ak_json_u64 Index = Stream->StrIndex;
+    ak_json_u64 Depth = 0;
+    while(Index < Length)
     {
-        switch(Token->Type)
+        ak_json_u8 Char = Str[Index++];
+        if(Char == '"')
         {
-            case AK_JSON__TOKEN_TYPE_OBJECT_END:
-            {
-                if((ParsingState == AK_JSON__OBJECT_PARSING_STATE_INITIAL) || 
-                   (ParsingState == AK_JSON__OBJECT_PARSING_STATE_VALUE))
-                {
-                    HasFinishedCorrectly = 1;
-                    AK_Json__Parser_Increment_Token(Parser);
-                }
-                else
-                {
-                    //TODO(JJ): Diagnostic and error logging
-                    return NULL;
-                }
-            } break;
-            
-            case AK_JSON__TOKEN_TYPE_OBJECT_KEY_DELIMITER:
-            {
-                if(ParsingState == AK_JSON__OBJECT_PARSING_STATE_KEY)
-                {
-                    AK_Json__Parser_Increment_Token(Parser);
-                    ParsingState = AK_JSON__OBJECT_PARSING_STATE_DELIMTER;
-                }
-                else
-                {
-                    //TODO(JJ): Diagnostic and error logging
-                    return NULL;
-                }
-            } break;
-            
-            case AK_JSON__TOKEN_TYPE_COMMA:
+            for(;;)
             {
-                if(ParsingState == AK_JSON__OBJECT_PARSING_STATE_VALUE)
-                {
-                    AK_Json__Parser_Increment_Token(Parser);
-                    ParsingState = AK_JSON__OBJECT_PARSING_STATE_COMMA;
-                }
-                else
+                Index = AK_Json__Find_String_Special(Str, Index, Length);
+                if(Index >= Length) break;
+                if(Str[Index] == '"')
                 {
-                    //TODO(JJ): Diagnostic and error logging
-                    return NULL;
+                    Index++;
+                    break;
                 }
-            } break;
-            
-            default:
+                Index += Str[Index] == '\\' ? 2 : 1;
+            }
+        }
+        else if(Char == '[' || Char == '{')
+        {
+            Depth++;
+        }
+        else if(Char == ']' || Char == '}')
+        {
+            if(!--Depth)
             {
-                if(ParsingState == AK_JSON__OBJECT_PARSING_STATE_INITIAL || 
-                   ParsingState == AK_JSON__OBJECT_PARSING_STATE_COMMA)
-                {
-                    if(Token->Type != AK_JSON__TOKEN_TYPE_STRING)
-                    {
-                        //TODO(JJ): Diagnostic and error logging
-                        return NULL;
-                    }
-                    ParsingState = AK_JSON__OBJECT_PARSING_STATE_KEY;
-                    
-                    //TODO(JJ): Parsing key here
-                }
-                else if(ParsingState == AK_JSON__OBJECT_PARSING_STATE_DELIMTER)
-                {
-                    ParsingState = AK_JSON__OBJECT_PARSING_STATE_VALUE;
-                    
-                    //TODO(JJ): Parsing value here
-                }
-                else
-                {
-                    //TODO(JJ): Diagnostic and error logging
-                    return NULL;
-                }
-            } break;
+                Stream->StrIndex = Index;
+                return 1;
+            }
         }
     }
     
-    if(!HasFinishedCorrectly)
-    {
-        //TODO(JJ): Diagnostic and error logging
-        return NULL;
-    }
-    
-    return Value;
+    Stream->StrIndex = Length;
+    return 0;
 }
 
-static ak_json__tmp_value* AK_Json__Parse_Generic(ak_json__parser* Parser)
+static int AK_Json__Lazy_Skip_Value(ak_json_lazy Lazy, ak_json__stream* Stream)
 {
-    ak_json__token* Token = AK_Json__Parser_Peek_Token(Parser);
-    
-    ak_json__tmp_value* RootValue = NULL;
-    switch(Token->Type)
+    int HasEscapes;
+    int Boolean;
+    switch(Lazy.Str.Str[Lazy.Index])
     {
-        case AK_JSON__TOKEN_TYPE_NULL:
+        case 'n':
         {
-            RootValue = AK_Json__Parse_Null_Value(Parser);
+            if(AK_Json__Scan_Null(Stream)) return 1;
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Lazy.Index, AK_Json_Str("Expecting null value. Got undefined."));
         } break;
         
-        case AK_JSON__TOKEN_TYPE_BOOLEAN:
+        case 't':
+        case 'f':
         {
-            RootValue = AK_Json__Parse_Boolean_Value(Parser);
+            if(AK_Json__Scan_Boolean(Stream, &Boolean)) return 1;
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Lazy.Index, AK_Json_Str("Expecting boolean value. Got undefined."));
         } break;
         
-        case AK_JSON__TOKEN_TYPE_NUMBER:
+        case '"':
         {
-            RootValue = AK_Json__Parse_Number_Value(Parser);
+            if(AK_Json__Scan_String(Stream, &HasEscapes)) return 1;
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Lazy.Index, AK_Json_Str("Expecting string value. Got undefined."));
         } break;
         
-        case AK_JSON__TOKEN_TYPE_STRING:
+        case '[':
         {
-            RootValue = AK_Json__Parse_String_Value(Parser);
+            if(AK_Json__Lazy_Skip_Container(Stream)) return 1;
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_ARRAY_PARSING, Lazy.Index, AK_Json_Str("Error parsing array. Expected , or ] characters. Got EOF."));
         } break;
         
-        case AK_JSON__TOKEN_TYPE_ARRAY_START:
+        case '{':
         {
-            RootValue = AK_Json__Parse_Array_Value(Parser);
+            if(AK_Json__Lazy_Skip_Container(Stream)) return 1;
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_OBJECT_PARSING, Lazy.Index, AK_Json_Str("Error parsing object. Expected , or } characters. Got EOF."));
         } break;
         
         default:
         {
-            //TODO(JJ): Implement this case
+            if(AK_Json__Scan_Number(Stream)) return 1;
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Lazy.Index, AK_Json_Str("Expecting numeric value. Got undefined."));
         } break;
     }
+    return 0;
+}
+
+static int AK_Json__Lazy_Get_Number(ak_json_lazy Lazy, ak_json__number* Number)
+{
+    AK_JSON_ASSERT(AK_Json_Lazy_Get_Type(Lazy) == AK_JSON_VALUE_TYPE_NUMBER);
+    ak_json__stream Stream = AK_Json__Lazy_Get_Stream(Lazy);
+    if(!AK_Json__Scan_Number(&Stream))
+    {
+        AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Lazy.Index, AK_Json_Str("Expecting numeric value. Got undefined."));
+        Number->Type  = AK_JSON__NUMBER_TYPE_INT64;
+        Number->Int64 = 0;
+        return 0;
+    }
     
-    return RootValue;
+    ak_json_str NumberStr = AK_Json_Str__Substr(Lazy.Str, Lazy.Index, Stream.StrIndex);
+    if(!AK_Json__Json_Str_To_Integer(NumberStr, Number))
+    {
+        Number->Type  = AK_JSON__NUMBER_TYPE_FLOAT;
+        Number->Float = AK_Json__Json_Str_To_Number(NumberStr);
+    }
+    return 1;
 }
 
-typedef struct ak_json_object
+//NOTE(EVERYONE): The first key of an object is checked here, later ones when stepping past a value
+static ak_json_lazy AK_Json__Lazy_Get_Key_At(ak_json_lazy Lazy, ak_json__stream* Stream)
 {
-} ak_json_object;
+    if(Stream->Str.Str[Stream->StrIndex] != '"')
+    {
+        AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_OBJECT_PARSING, Stream->StrIndex, AK_Json_Str("Error parsing object. Expected a string key."));
+        return AK_Json__Lazy_Invalid();
+    }
+    return AK_Json__Lazy_Create(Lazy.Context, Lazy.Str, Stream->StrIndex, AK_JSON_VALUE_TYPE_OBJECT, 1);
+}
 
-typedef struct ak_json_array
+AK_JSON_DEF ak_json_lazy AK_Json_Parse_Lazy(ak_json_context* Context, ak_json_str Str)
 {
-    unsigned int          Count;
-    struct ak_json_value* First;
-    struct ak_json_value* Last;
-} ak_json_array;
+    ak_json__stream Stream = AK_Json__Stream_Create(Str);
+    AK_Json__Stream_Eat_Whitespace(&Stream);
+    if(!AK_Json__Stream_Is_Valid(&Stream)) return AK_Json__Lazy_Invalid();
+    return AK_Json__Lazy_Create(Context, Str, Stream.StrIndex, AK_JSON_VALUE_TYPE_NULL, 0);
+}
 
-typedef struct ak_json_value
+//NOTE(EVERYONE): A lazy value is invalid past the last value of its array or object, past the root, or 
+//after an error
+AK_JSON_DEF int AK_Json_Lazy_Is_Valid(ak_json_lazy Lazy)
 {
-    ak_json_value_type Type;
-    union
+    return Lazy.Context != NULL;
+}
+
+AK_JSON_DEF ak_json_value_type AK_Json_Lazy_Get_Type(ak_json_lazy Lazy)
+{
+    AK_JSON_ASSERT(AK_Json_Lazy_Is_Valid(Lazy));
+    switch(Lazy.Str.Str[Lazy.Index])
     {
-        ak_json_str    String;
-        int            Boolean;
-        double         Number;
-        ak_json_array  Array;
-        ak_json_object Object;
-    };
-    
-    struct ak_json_value* Prev;
-    struct ak_json_value* Next;
-} ak_json_value;
+        case 'n': return AK_JSON_VALUE_TYPE_NULL;
+        case 't':
+        case 'f': return AK_JSON_VALUE_TYPE_BOOLEAN;
+        case '"': return AK_JSON_VALUE_TYPE_STRING;
+        case '[': return AK_JSON_VALUE_TYPE_ARRAY;
+        case '{': return AK_JSON_VALUE_TYPE_OBJECT;
+        default: return AK_JSON_VALUE_TYPE_NUMBER;
+    }
+}
 
-static ak_json_value* AK_Json__Value_Copy(ak_json_context* Context, ak_json__tmp_value* TmpValue)
+//NOTE(EVERYONE): Strings without escapes point straight into the input and are not null terminated. Strings 
+//with escapes are decoded into the context arena
+AK_JSON_DEF ak_json_str AK_Json_Lazy_Get_String(ak_json_lazy Lazy)
 {
-    ak_json_value* Value = Context->FreeValues;
-    if(!Value) Value = (ak_json_value*)AK_Json__Arena_Push(Context->Arena, sizeof(ak_json_value));
-    else Context->FreeValues = Context->FreeValues->Next;
+    AK_JSON_ASSERT(AK_Json_Lazy_Get_Type(Lazy) == AK_JSON_VALUE_TYPE_STRING);
+    ak_json__stream Stream = AK_Json__Lazy_Get_Stream(Lazy);
     
-    Value->Type = TmpValue->Type;
-    switch(TmpValue->Type)
+    int HasEscapes;
+    if(!AK_Json__Scan_String(&Stream, &HasEscapes))
     {
-        case AK_JSON_VALUE_TYPE_NULL:
-        {
-            //NOTE(EVERYONE): Do nothing
-        } break;
-        
-        case AK_JSON_VALUE_TYPE_BOOLEAN:
-        {
-            Value->Boolean = TmpValue->Boolean;
-        } break;
-        
-        case AK_JSON_VALUE_TYPE_NUMBER:
-        {
-            Value->Number = TmpValue->Number;
-        } break;
-        
-        case AK_JSON_VALUE_TYPE_STRING:
-        {
-            Value->String = AK_Json_Str__Copy(Context->Arena, TmpValue->String);
-        } break;
-        
-        case AK_JSON_VALUE_TYPE_ARRAY:
-        {
-            ak_json_array* Array = &Value->Array;
-            Array->Count = TmpValue->Array.Count;
-            Array->First = NULL;
-            Array->Last  = NULL;
-            
-            ak_json__tmp_value* ArrayTmpValue;
-            for(ArrayTmpValue = TmpValue->Array.First; ArrayTmpValue; ArrayTmpValue = ArrayTmpValue->Next)
-            {
-                ak_json_value* TmpValue = AK_Json__Value_Copy(Context, ArrayTmpValue);
-                
-                if(!Array->First) Array->First = TmpValue;
-                else 
-                {
-                    TmpValue->Prev    = Array->Last;
-                    Array->Last->Next = TmpValue;
-                }
-                Array->Last = TmpValue;
-            }
-        } break;
-        
-        case AK_JSON_VALUE_TYPE_OBJECT:
-        {
-            //TODO(JJ): Not implemented
-        } break;
+        AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Lazy.Index, AK_Json_Str("Expecting string value. Got undefined."));
+        return AK_Json_Str_Create(NULL, 0);
     }
     
-    return Value;
+    ak_json_str Result = AK_Json_Str_Create(Lazy.Str.Str+Lazy.Index+1, Stream.StrIndex-Lazy.Index-2);
+    if(HasEscapes) Result = AK_Json__Json_Str_To_UTF8(Lazy.Context->Arena, Result, HasEscapes);
+    return Result;
 }
 
-AK_JSON_DEF ak_json_value* AK_Json_Parse(ak_json_context* Context, ak_json_str Str)
+AK_JSON_DEF int AK_Json_Lazy_Get_Boolean(ak_json_lazy Lazy)
 {
-    ak_json__arena* ParseArena = AK_Json__Arena_Create(Context->Arena->Allocator, Str.Length*2);
-    if(!ParseArena) return NULL;
+    AK_JSON_ASSERT(AK_Json_Lazy_Get_Type(Lazy) == AK_JSON_VALUE_TYPE_BOOLEAN);
+    ak_json__stream Stream = AK_Json__Lazy_Get_Stream(Lazy);
     
-    ak_json__tokenizer Tokenizer;
-    AK_Json__Memory_Clear(&Tokenizer, sizeof(ak_json__tokenizer));
-    Tokenizer.TokenArena = ParseArena;
-    Tokenizer.ErrorArena = Context->Arena;
+    int Boolean = 0;
+    if(!AK_Json__Scan_Boolean(&Stream, &Boolean))
+        AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_UNDEFINED_TOKEN, Lazy.Index, AK_Json_Str("Expecting boolean value. Got undefined."));
+    return Boolean;
+}
+
+AK_JSON_DEF double AK_Json_Lazy_Get_Number(ak_json_lazy Lazy)
+{
+    ak_json__number Number;
+    AK_Json__Lazy_Get_Number(Lazy, &Number);
+    switch(Number.Type)
+    {
+        case AK_JSON__NUMBER_TYPE_INT64: return (double)Number.Int64;
+        case AK_JSON__NUMBER_TYPE_UINT64: return (double)Number.Uint64;
+        default: return Number.Float;
+    }
+}
+
+AK_JSON_DEF int AK_Json_Lazy_Is_Integer(ak_json_lazy Lazy)
+{
+    ak_json__number Number;
+    if(AK_Json_Lazy_Get_Type(Lazy) != AK_JSON_VALUE_TYPE_NUMBER) return 0;
+    return AK_Json__Lazy_Get_Number(Lazy, &Number) && Number.Type != AK_JSON__NUMBER_TYPE_FLOAT;
+}
+
+AK_JSON_DEF ak_json_s64 AK_Json_Lazy_Get_Int64(ak_json_lazy Lazy)
+{
+    ak_json__number Number;
+    AK_Json__Lazy_Get_Number(Lazy, &Number);
+    AK_JSON_ASSERT(Number.Type == AK_JSON__NUMBER_TYPE_INT64);
+    return Number.Int64;
+}
+
+AK_JSON_DEF ak_json_u64 AK_Json_Lazy_Get_Uint64(ak_json_lazy Lazy)
+{
+    ak_json__number Number;
+    AK_Json__Lazy_Get_Number(Lazy, &Number);
+    AK_JSON_ASSERT(Number.Type == AK_JSON__NUMBER_TYPE_UINT64 || (Number.Type == AK_JSON__NUMBER_TYPE_INT64 && Number.Int64 >= 0));
+    return Number.Uint64;
+}
+
+//NOTE(EVERYONE): The first element of an array, or the first key of an object. Walking an object with 
+//AK_Json_Lazy_Get_Next alternates between keys and their values, the same as a tape cursor
+AK_JSON_DEF ak_json_lazy AK_Json_Lazy_Get_First(ak_json_lazy Lazy)
+{
+    ak_json_value_type Type = AK_Json_Lazy_Get_Type(Lazy);
+    AK_JSON_ASSERT(Type == AK_JSON_VALUE_TYPE_ARRAY || Type == AK_JSON_VALUE_TYPE_OBJECT);
+    
+    ak_json__stream Stream = AK_Json__Lazy_Get_Stream(Lazy);
+    AK_Json__Stream_Increment(&Stream);
+    AK_Json__Stream_Eat_Whitespace(&Stream);
+    if(!AK_Json__Stream_Is_Valid(&Stream))
+    {
+        if(Type == AK_JSON_VALUE_TYPE_ARRAY)
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_ARRAY_PARSING, Lazy.Index, AK_Json_Str("Error parsing array. Expected , or ] characters. Got EOF."));
+        else
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_OBJECT_PARSING, Lazy.Index, AK_Json_Str("Error parsing object. Expected , or } characters. Got EOF."));
+        return AK_Json__Lazy_Invalid();
+    }
     
-    if(!AK_Json__Tokenize(&Tokenizer, Str)) 
+    ak_json_u8 Char = AK_Json__Stream_Peek_Char(&Stream).Char;
+    if(Type == AK_JSON_VALUE_TYPE_ARRAY)
     {
-        return NULL;
+        if(Char == ']') return AK_Json__Lazy_Invalid();
+        return AK_Json__Lazy_Create(Lazy.Context, Lazy.Str, Stream.StrIndex, AK_JSON_VALUE_TYPE_ARRAY, 0);
     }
     
-    ak_json__parser Parser;
-    Parser.Arena        = Context->Arena;
-    Parser.ErrorArena   = Context->Arena;
-    Parser.Str          = Str;
-    Parser.Tokens       = Tokenizer.Tokens;
-    Parser.CurrentToken = Parser.Tokens.First;
+    if(Char == '}') return AK_Json__Lazy_Invalid();
+    return AK_Json__Lazy_Get_Key_At(Lazy, &Stream);
+}
+
+AK_JSON_DEF ak_json_lazy AK_Json_Lazy_Get_Next(ak_json_lazy Lazy)
+{
+    AK_JSON_ASSERT(AK_Json_Lazy_Is_Valid(Lazy));
+    if(Lazy.Parent == AK_JSON_VALUE_TYPE_NULL) return AK_Json__Lazy_Invalid();
     
-    ak_json__tmp_value* RootValue = AK_Json__Parse_Generic(&Parser);
+    ak_json__stream Stream = AK_Json__Lazy_Get_Stream(Lazy);
+    if(!AK_Json__Lazy_Skip_Value(Lazy, &Stream)) return AK_Json__Lazy_Invalid();
     
-    ak_json_value* Result = NULL;
-    if(RootValue) Result = AK_Json__Value_Copy(Context, RootValue);
+    AK_Json__Stream_Eat_Whitespace(&Stream);
+    ak_json_u8 Char = AK_Json__Stream_Is_Valid(&Stream) ? AK_Json__Stream_Peek_Char(&Stream).Char : 0;
+    ak_json_u64 CharIndex = Stream.StrIndex;
     
-    AK_Json__Arena_Delete(ParseArena);
-    return Result;
+    if(Lazy.Parent == AK_JSON_VALUE_TYPE_ARRAY)
+    {
+        if(Char == ']') return AK_Json__Lazy_Invalid();
+        if(Char != ',')
+        {
+            if(!Char) AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_ARRAY_PARSING, Lazy.Index, AK_Json_Str("Error parsing array. Expected , or ] characters. Got EOF."));
+            else AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_ARRAY_PARSING, CharIndex, AK_Json_Str("Error parsing array. Expected , or ] characters."));
+            return AK_Json__Lazy_Invalid();
+        }
+    }
+    else if(Lazy.IsKey)
+    {
+        if(Char != ':')
+        {
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_OBJECT_PARSING, CharIndex, AK_Json_Str("Error parsing object. Expected : after key."));
+            return AK_Json__Lazy_Invalid();
+        }
+    }
+    else
+    {
+        if(Char == '}') return AK_Json__Lazy_Invalid();
+        if(Char != ',')
+        {
+            if(!Char) AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_OBJECT_PARSING, Lazy.Index, AK_Json_Str("Error parsing object. Expected , or } characters. Got EOF."));
+            else AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_OBJECT_PARSING, CharIndex, AK_Json_Str("Error parsing object. Expected , or } characters."));
+            return AK_Json__Lazy_Invalid();
+        }
+    }
+    
+    AK_Json__Stream_Increment(&Stream);
+    AK_Json__Stream_Eat_Whitespace(&Stream);
+    if(!AK_Json__Stream_Is_Valid(&Stream))
+    {
+        if(Lazy.Parent == AK_JSON_VALUE_TYPE_ARRAY)
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_ARRAY_PARSING, CharIndex, AK_Json_Str("Error parsing array. Expected , or ] characters. Got EOF."));
+        else
+            AK_Json__Lazy_Error(Lazy, AK_JSON_ERROR_CODE_OBJECT_PARSING, CharIndex, AK_Json_Str("Error parsing object. Expected , or } characters. Got EOF."));
+        return AK_Json__Lazy_Invalid();
+    }
+    
+    if(Lazy.Parent == AK_JSON_VALUE_TYPE_OBJECT && !Lazy.IsKey) return AK_Json__Lazy_Get_Key_At(Lazy, &Stream);
+    return AK_Json__Lazy_Create(Lazy.Context, Lazy.Str, Stream.StrIndex, Lazy.Parent, 0);
 }
 
-/***********
-*** Keys ***
-************/
-
-#if 0 
-AK_JSON_DEF ak_json_str AK_Json_Key_Get_Name(ak_json_key* Key)
+//NOTE(EVERYONE): The length of a lazy array is not known up front, so an index past the end returns an 
+//invalid value instead of asserting
+AK_JSON_DEF ak_json_lazy AK_Json_Lazy_Get_Value(ak_json_lazy Array, unsigned int Index)
 {
-    return Key->Str;
+    AK_JSON_ASSERT(AK_Json_Lazy_Get_Type(Array) == AK_JSON_VALUE_TYPE_ARRAY);
+    ak_json_lazy Result = AK_Json_Lazy_Get_First(Array);
+    while(Index-- && AK_Json_Lazy_Is_Valid(Result)) Result = AK_Json_Lazy_Get_Next(Result);
+    return Result;
 }
 
-AK_JSON_DEF ak_json_value* AK_Json_Key_Get_Value(ak_json_key* Key)
+//NOTE(EVERYONE): Keys without escapes are compared in place, only escaped keys get decoded
+AK_JSON_DEF ak_json_lazy AK_Json_Lazy_Get_Key(ak_json_lazy Object, ak_json_str Key)
 {
-    return Key->Value;
+    AK_JSON_ASSERT(AK_Json_Lazy_Get_Type(Object) == AK_JSON_VALUE_TYPE_OBJECT);
+    ak_json_lazy Name = AK_Json_Lazy_Get_First(Object);
+    while(AK_Json_Lazy_Is_Valid(Name))
+    {
+        ak_json_lazy Value = AK_Json_Lazy_Get_Next(Name);
+        if(!AK_Json_Lazy_Is_Valid(Value)) break;
+        if(AK_Json_Str__Equal(AK_Json_Lazy_Get_String(Name), Key)) return Value;
+        Name = AK_Json_Lazy_Get_Next(Value);
+    }
+    return AK_Json__Lazy_Invalid();
 }
-#endif
 
-/*************
-*** Values ***
-**************/
-AK_JSON_DEF ak_json_value_type AK_Json_Value_Get_Type(ak_json_value* Value)
+/***************
+*** Pointers ***
+****************/
+
+//NOTE(EVERYONE): A compiled JSON Pointer (RFC 6901). Every reference token is unescaped and interned once 
+//when compiling, so evaluating it is just a walk over the segments with no allocation and no string work. 
+//Tokens that are also valid array indices keep the parsed index, which arrays use and objects ignore. 
+//The pointer lives in the context arena
+#define AK_JSON__POINTER_NO_INDEX 0xFFFFFFFFFFFFFFFFull
+
+typedef struct ak_json__pointer_segment
 {
-    return Value->Type;
-}
+    ak_json_str Key;
+    ak_json_u64 Hash;
+    ak_json_u64 Index;
+} ak_json__pointer_segment;
 
-AK_JSON_DEF ak_json_str AK_Json_Value_Get_String(ak_json_value* Value)
+typedef struct ak_json_pointer
 {
-    AK_JSON_ASSERT(Value->Type == AK_JSON_VALUE_TYPE_STRING);
-    return Value->String;
-}
+    ak_json_u64               Count;
+    ak_json__pointer_segment* Segments;
+} ak_json_pointer;
 
-AK_JSON_DEF int AK_Json_Value_Get_Boolean(ak_json_value* Value)
+static void AK_Json__Pointer_Error(ak_json_str Pointer, ak_json_u64 Index, ak_json_str Message)
 {
-    AK_JSON_ASSERT(Value->Type == AK_JSON_VALUE_TYPE_BOOLEAN);
-    return Value->Boolean;
+    ak_json__char Char;
+    Char.Index = Index < Pointer.Length ? Index : Pointer.Length-1;
+    Char.Char  = Pointer.Str[Char.Index];
+    AK_Json__Error_Log(Pointer, AK_JSON_ERROR_CODE_POINTER_PARSING, Char, Message);
 }
 
-AK_JSON_DEF double AK_Json_Value_Get_Number(ak_json_value* Value)
+//NOTE(EVERYONE): Array indices are 0 or a digit string without a leading zero. "-" and anything that does 
+//not fit an array length never match an element
+static ak_json_u64 AK_Json__Pointer_Parse_Index(ak_json_str Token)
 {
-    AK_JSON_ASSERT(Value->Type == AK_JSON_VALUE_TYPE_NUMBER);
-    return Value->Number;
+    if(!Token.Length || Token.Length > 10) return AK_JSON__POINTER_NO_INDEX;
+    if(Token.Str[0] == '0' && Token.Length > 1) return AK_JSON__POINTER_NO_INDEX;
+    
+    ak_json_u64 Result = 0;
+    ak_json_u64 Index;
+    for(Index = 0; Index < Token.Length; Index++)
+    {
+        if(!AK_Json__Is_Digit(Token.Str[Index])) return AK_JSON__POINTER_NO_INDEX;
+        Result = Result*10 + (Token.Str[Index]-'0');
+    }
+    return Result <= 0xFFFFFFFFull ? Result : AK_JSON__POINTER_NO_INDEX;
 }
 
-AK_JSON_DEF ak_json_array* AK_Json_Value_Get_Array(ak_json_value* Value)
+AK_JSON_DEF ak_json_pointer* AK_Json_Pointer_Compile(ak_json_context* Context, ak_json_str Pointer)
 {
-    AK_JSON_ASSERT(Value->Type == AK_JSON_VALUE_TYPE_ARRAY);
-    return &Value->Array;
+    if(Pointer.Length && Pointer.Str[0] != '/')
+    {
+        AK_Json__Pointer_Error(Pointer, 0, AK_Json_Str("Error parsing pointer. Expected / at the start."));
+        return NULL;
+    }
+    
+    ak_json_u64 Count = 0;
+    ak_json_u64 Index;
+    for(Index = 0; Index < Pointer.Length; Index++)
+    {
+        if(Pointer.Str[Index] == '/') Count++;
+    }
+    
+    ak_json_pointer* Result = (ak_json_pointer*)AK_Json__Arena_Push(Context->Arena, sizeof(ak_json_pointer)+Count*sizeof(ak_json__pointer_segment));
+    ak_json_u8* Buffer = (ak_json_u8*)AK_Json__Arena_Push(Context->Arena, Pointer.Length+1);
+    if(!Result || !Buffer) return NULL;
+    
+    Result->Count = Count;
+    Result->Segments = (ak_json__pointer_segment*)(Result+1);
+    
+    //NOTE(EVERYONE): Tokens are unescaped into a scratch buffer and only the interned copy is kept
+    ak_json_u64 SegmentIndex = 0;
+    Index = 1;
+    while(SegmentIndex < Count)
+    {
+        ak_json_str Token = AK_Json_Str_Create(Buffer, 0);
+        while(Index < Pointer.Length && Pointer.Str[Index] != '/')
+        {
+            ak_json_u8 Char = Pointer.Str[Index++];
+            if(Char == '~')
+            {
+                ak_json_u8 Escape = Index < Pointer.Length ? Pointer.Str[Index] : 0;
+                if(Escape != '0' && Escape != '1')
+                {
+                    AK_Json__Pointer_Error(Pointer, Index-1, AK_Json_Str("Error parsing pointer. Expected 0 or 1 after ~."));
+                    return NULL;
+                }
+                Char = Escape == '0' ? '~' : '/';
+                Index++;
+            }
+            Buffer[Token.Length++] = Char;
+        }
+        Index++;
+        
+        ak_json__pointer_segment* Segment = Result->Segments + SegmentIndex++;
+        Segment->Key = AK_Json__Key_Table_Intern(&Context->Keys, Token);
+        if(!Segment->Key.Str) return NULL;
+        Segment->Hash  = AK_Json__Interned_Key_Get(Segment->Key.Str)->Hash;
+        Segment->Index = AK_Json__Pointer_Parse_Index(Segment->Key);
+    }
+    
+    return Result;
 }
 
-AK_JSON_DEF ak_json_object* AK_Json_Value_Get_Object(ak_json_value* Value)
+//NOTE(EVERYONE): Returns NULL when the pointer does not resolve in Value
+AK_JSON_DEF ak_json_value* AK_Json_Pointer_Get(ak_json_value* Value, ak_json_pointer* Pointer)
 {
-    AK_JSON_ASSERT(Value->Type == AK_JSON_VALUE_TYPE_OBJECT);
-    return &Value->Object;
+    ak_json_u64 SegmentIndex;
+    for(SegmentIndex = 0; SegmentIndex < Pointer->Count && Value; SegmentIndex++)
+    {
+        ak_json__pointer_segment* Segment = Pointer->Segments + SegmentIndex;
+        switch(AK_Json_Value_Get_Type(Value))
+        {
+            case AK_JSON_VALUE_TYPE_ARRAY:
+            {
+                ak_json_array* Array = AK_Json_Value_Get_Array(Value);
+                Value = Segment->Index < AK_Json_Array_Get_Length(Array) ? AK_Json_Array_Get_Value(Array, (unsigned int)Segment->Index) : NULL;
+            } break;
+            
+            case AK_JSON_VALUE_TYPE_OBJECT:
+            {
+                ak_json_key* Key = AK_Json_Object_Get_Key_Hashed(AK_Json_Value_Get_Object(Value), Segment->Key, Segment->Hash);
+                Value = Key ? AK_Json_Key_Get_Value(Key) : NULL;
+            } break;
+            
+            default:
+            {
+                Value = NULL;
+            } break;
+        }
+    }
+    return Value;
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,536 @@
+#define AK_JSON_IMPLEMENTATION
+#include "ak_json.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct ak_json_bench_buffer
+{
+    ak_json_u8* Data;
+    ak_json_u64 Length;
+    ak_json_u64 Capacity;
+} ak_json_bench_buffer;
+
+static ak_json_bench_buffer AK_Json_Bench_Buffer_Create(ak_json_u64 Capacity)
+{
+    ak_json_bench_buffer Buffer;
+    Buffer.Data = (ak_json_u8*)malloc(Capacity+1);
+    Buffer.Length = 0;
+    Buffer.Capacity = Capacity;
+    return Buffer;
+}
+
+static void AK_Json_Bench_Buffer_Append(ak_json_bench_buffer* Buffer, const char* Str)
+{
+    while(*Str && Buffer->Length < Buffer->Capacity)
+        Buffer->Data[Buffer->Length++] = (ak_json_u8)*Str++;
+    Buffer->Data[Buffer->Length] = 0;
+}
+
+static ak_json_str AK_Json_Bench_Buffer_Str(ak_json_bench_buffer* Buffer)
+{
+    return AK_Json_Str_Create(Buffer->Data, Buffer->Length);
+}
+
+static void AK_Json_Bench_Run(const char* Name, ak_json_str Str, unsigned int Iterations)
+{
+    clock_t Start = clock();
+
+    unsigned int Index;
+    for(Index = 0; Index < Iterations; Index++)
+    {
+        ak_json_context* Context = AK_Json_Create(NULL);
+        if(!AK_Json_Parse(Context, Str))
+        {
+            printf("%-32s failed: %s\n", Name, (const char*)AK_Json_Get_Error_Message().Str);
+            AK_Json_Delete(Context);
+            return;
+        }
+        AK_Json_Delete(Context);
+    }
+
+    double Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    double Megabytes = ((double)Str.Length*Iterations)/(1024.0*1024.0);
+    printf("%-32s %10.2f MB/s (%llu bytes x %u)\n", Name, Seconds > 0 ? Megabytes/Seconds : 0.0, Str.Length, Iterations);
+}
+
+//NOTE(EVERYONE): Same as AK_Json_Bench_Run but keeps one context alive and resets it between parses
+static void AK_Json_Bench_Run_Reset(const char* Name, ak_json_str Str, unsigned int Iterations)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    clock_t Start = clock();
+
+    unsigned int Index;
+    for(Index = 0; Index < Iterations; Index++)
+    {
+        AK_Json_Context_Reset(Context, 0);
+        if(!AK_Json_Parse(Context, Str))
+        {
+            printf("%-32s failed: %s\n", Name, (const char*)AK_Json_Get_Error_Message().Str);
+            AK_Json_Delete(Context);
+            return;
+        }
+    }
+
+    double Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    double Megabytes = ((double)Str.Length*Iterations)/(1024.0*1024.0);
+    printf("%-32s %10.2f MB/s (%llu bytes x %u)\n", Name, Seconds > 0 ? Megabytes/Seconds : 0.0, Str.Length, Iterations);
+    AK_Json_Delete(Context);
+}
+
+//NOTE(EVERYONE): Same as AK_Json_Bench_Run but parses into one buffer sized for the worst case
+static void AK_Json_Bench_Run_Into(const char* Name, ak_json_str Str, unsigned int Iterations)
+{
+    ak_json_u64 Capacity = AK_Json_Max_Memory_For_Input(Str.Length);
+    void* Buffer = malloc(Capacity);
+    clock_t Start = clock();
+
+    unsigned int Index;
+    for(Index = 0; Index < Iterations; Index++)
+    {
+        if(!AK_Json_Parse_Into(Buffer, Capacity, Str))
+        {
+            printf("%-32s failed: %s\n", Name, (const char*)AK_Json_Get_Error_Message().Str);
+            free(Buffer);
+            return;
+        }
+    }
+
+    double Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    double Megabytes = ((double)Str.Length*Iterations)/(1024.0*1024.0);
+    printf("%-32s %10.2f MB/s (%llu bytes x %u)\n", Name, Seconds > 0 ? Megabytes/Seconds : 0.0, Str.Length, Iterations);
+    free(Buffer);
+}
+
+/*****************
+*** Whitespace ***
+******************/
+
+//NOTE(EVERYONE): Appends records until the next one would not fit in Size bytes, so the buffer is 
+//sized from the target input size rather than a worst case per record
+static ak_json_bench_buffer AK_Json_Bench_Build_Records(ak_json_u64 Size, int Indented)
+{
+    ak_json_bench_buffer Buffer = AK_Json_Bench_Buffer_Create(Size + 256);
+    if(!Buffer.Data) return Buffer;
+
+    const char* Indent0 = Indented ? "\n    " : "";
+    const char* Indent1 = Indented ? "\n        " : "";
+    const char* Space = Indented ? " " : "";
+
+    AK_Json_Bench_Buffer_Append(&Buffer, "[");
+
+    unsigned int Index;
+    for(Index = 0;; Index++)
+    {
+        char Record[256];
+        int RecordLength = snprintf(Record, sizeof(Record), "%s%s[%s%u,%s%s\"record\",%s%s%s%u.5,%s%strue,%s%snull%s]",
+                                    Index ? "," : "", Indent0, Indent1, Index, Space, Indent1, Space, Indent1, Index % 7 ? "-" : "", Index, 
+                                    Space, Indent1, Space, Indent1, Indent0);
+        if(Buffer.Length+RecordLength > Size) break;
+        AK_Json_Bench_Buffer_Append(&Buffer, Record);
+    }
+
+    AK_Json_Bench_Buffer_Append(&Buffer, Indented ? "\n]" : "]");
+    return Buffer;
+}
+
+static void AK_Json_Bench_Whitespace()
+{
+    ak_json_bench_buffer Minified = AK_Json_Bench_Build_Records(4*1024*1024, 0);
+    ak_json_bench_buffer Indented = AK_Json_Bench_Build_Records(4*1024*1024, 1);
+
+    AK_Json_Bench_Run("whitespace/minified", AK_Json_Bench_Buffer_Str(&Minified), 20);
+    AK_Json_Bench_Run("whitespace/indented", AK_Json_Bench_Buffer_Str(&Indented), 20);
+
+    free(Minified.Data);
+    free(Indented.Data);
+}
+
+/**************
+*** Strings ***
+***************/
+
+static ak_json_bench_buffer AK_Json_Bench_Build_Strings(unsigned int Count, unsigned int StringLength, const char* Fill)
+{
+    ak_json_bench_buffer Buffer = AK_Json_Bench_Buffer_Create((ak_json_u64)Count*(StringLength+128) + 64);
+    
+    AK_Json_Bench_Buffer_Append(&Buffer, "[");
+    
+    unsigned int Index;
+    for(Index = 0; Index < Count; Index++)
+    {
+        AK_Json_Bench_Buffer_Append(&Buffer, Index ? ",\"" : "\"");
+        
+        ak_json_u64 Start = Buffer.Length;
+        while(Buffer.Length-Start < StringLength)
+            AK_Json_Bench_Buffer_Append(&Buffer, Fill);
+        
+        AK_Json_Bench_Buffer_Append(&Buffer, "\"");
+    }
+    
+    AK_Json_Bench_Buffer_Append(&Buffer, "]");
+    return Buffer;
+}
+
+static void AK_Json_Bench_Strings()
+{
+    ak_json_bench_buffer Plain   = AK_Json_Bench_Build_Strings(1024*4, 1024, "QUJDREVGR0hJSktMTU5PUFFSU1RVVldYWVo=");
+    ak_json_bench_buffer Escaped = AK_Json_Bench_Build_Strings(1024*4, 1024, "<p class=\\\"x\\\">\\n\\t\\u00e9</p>");
+    
+    AK_Json_Bench_Run("strings/escape_free", AK_Json_Bench_Buffer_Str(&Plain), 20);
+    AK_Json_Bench_Run("strings/escape_heavy", AK_Json_Bench_Buffer_Str(&Escaped), 20);
+    
+    free(Plain.Data);
+    free(Escaped.Data);
+}
+
+/**************
+*** Numbers ***
+***************/
+
+//NOTE(EVERYONE): Shaped like canada.json, polygons of longitude/latitude pairs printed with 15 decimals
+static ak_json_bench_buffer AK_Json_Bench_Build_Coordinates(unsigned int PolygonCount, unsigned int PointCount)
+{
+    ak_json_bench_buffer Buffer = AK_Json_Bench_Buffer_Create((ak_json_u64)PolygonCount*(PointCount*48+8) + 64);
+    
+    ak_json_u32 Seed = 0x9E3779B9;
+    AK_Json_Bench_Buffer_Append(&Buffer, "[");
+    
+    unsigned int PolygonIndex;
+    for(PolygonIndex = 0; PolygonIndex < PolygonCount; PolygonIndex++)
+    {
+        AK_Json_Bench_Buffer_Append(&Buffer, PolygonIndex ? ",[" : "[");
+        
+        unsigned int PointIndex;
+        for(PointIndex = 0; PointIndex < PointCount; PointIndex++)
+        {
+            Seed = Seed*1664525 + 1013904223;
+            double Longitude = -141.0 + 88.0*((double)(Seed >> 8)/16777216.0);
+            Seed = Seed*1664525 + 1013904223;
+            double Latitude = 41.0 + 42.0*((double)(Seed >> 8)/16777216.0);
+            
+            char Point[64];
+            snprintf(Point, sizeof(Point), "%s[%.15f,%.15f]", PointIndex ? "," : "", Longitude, Latitude);
+            AK_Json_Bench_Buffer_Append(&Buffer, Point);
+        }
+        
+        AK_Json_Bench_Buffer_Append(&Buffer, "]");
+    }
+    
+    AK_Json_Bench_Buffer_Append(&Buffer, "]");
+    return Buffer;
+}
+
+static ak_json_bench_buffer AK_Json_Bench_Build_Integers(unsigned int Count)
+{
+    ak_json_bench_buffer Buffer = AK_Json_Bench_Buffer_Create((ak_json_u64)Count*24 + 64);
+    
+    ak_json_u64 Seed = 0x9E3779B97F4A7C15ull;
+    AK_Json_Bench_Buffer_Append(&Buffer, "[");
+    
+    unsigned int Index;
+    for(Index = 0; Index < Count; Index++)
+    {
+        Seed = Seed*6364136223846793005ull + 1442695040888963407ull;
+        
+        //NOTE(EVERYONE): Mix of 64 bit ids and small counters
+        char Integer[32];
+        snprintf(Integer, sizeof(Integer), "%s%llu", Index ? "," : "", (Index & 1) ? (Seed >> 1) : (Seed >> 54));
+        AK_Json_Bench_Buffer_Append(&Buffer, Integer);
+    }
+    
+    AK_Json_Bench_Buffer_Append(&Buffer, "]");
+    return Buffer;
+}
+
+static void AK_Json_Bench_Numbers()
+{
+    ak_json_bench_buffer Coordinates = AK_Json_Bench_Build_Coordinates(48, 1150);
+    ak_json_bench_buffer Integers    = AK_Json_Bench_Build_Integers(1024*128);
+    
+    AK_Json_Bench_Run("numbers/coordinates", AK_Json_Bench_Buffer_Str(&Coordinates), 20);
+    AK_Json_Bench_Run("numbers/integers", AK_Json_Bench_Buffer_Str(&Integers), 20);
+    
+    free(Coordinates.Data);
+    free(Integers.Data);
+}
+
+/*************
+*** Arrays ***
+**************/
+
+static void AK_Json_Bench_Arrays()
+{
+    ak_json_bench_buffer Integers = AK_Json_Bench_Build_Integers(1024*100);
+    AK_Json_Bench_Run("arrays/parse", AK_Json_Bench_Buffer_Str(&Integers), 20);
+    
+    ak_json_context* Context = AK_Json_Create(NULL);
+    ak_json_array* Array = AK_Json_Value_Get_Array(AK_Json_Parse(Context, AK_Json_Bench_Buffer_Str(&Integers)));
+    unsigned int Length = AK_Json_Array_Get_Length(Array);
+    
+    clock_t Start = clock();
+    
+    ak_json_u32 Seed = 1;
+    ak_json_u64 Sum = 0;
+    unsigned int Index;
+    for(Index = 0; Index < 10000000; Index++)
+    {
+        Seed = Seed*1664525 + 1013904223;
+        Sum += AK_Json_Value_Get_Uint64(AK_Json_Array_Get_Value(Array, Seed % Length));
+    }
+    
+    double Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    printf("%-32s %10.2f M lookups/s (checksum %llu)\n", "arrays/random_access", Seconds > 0 ? 10.0/Seconds : 0.0, Sum);
+    
+    AK_Json_Delete(Context);
+    free(Integers.Data);
+}
+
+/**************
+*** Objects ***
+***************/
+
+static ak_json_bench_buffer AK_Json_Bench_Build_Telemetry(unsigned int RecordCount, unsigned int FieldCount)
+{
+    ak_json_bench_buffer Buffer = AK_Json_Bench_Buffer_Create((ak_json_u64)RecordCount*FieldCount*32 + 64);
+    AK_Json_Bench_Buffer_Append(&Buffer, "[");
+    
+    unsigned int RecordIndex;
+    for(RecordIndex = 0; RecordIndex < RecordCount; RecordIndex++)
+    {
+        AK_Json_Bench_Buffer_Append(&Buffer, RecordIndex ? ",{" : "{");
+        
+        unsigned int FieldIndex;
+        for(FieldIndex = 0; FieldIndex < FieldCount; FieldIndex++)
+        {
+            char Field[64];
+            snprintf(Field, sizeof(Field), "%s\"sensor_%u\":%u", FieldIndex ? "," : "", FieldIndex, RecordIndex ^ FieldIndex);
+            AK_Json_Bench_Buffer_Append(&Buffer, Field);
+        }
+        
+        AK_Json_Bench_Buffer_Append(&Buffer, "}");
+    }
+    
+    AK_Json_Bench_Buffer_Append(&Buffer, "]");
+    return Buffer;
+}
+
+static void AK_Json_Bench_Objects()
+{
+    ak_json_bench_buffer Telemetry = AK_Json_Bench_Build_Telemetry(200, 500);
+    AK_Json_Bench_Run("objects/parse", AK_Json_Bench_Buffer_Str(&Telemetry), 20);
+    AK_Json_Bench_Run_Reset("objects/parse_reset", AK_Json_Bench_Buffer_Str(&Telemetry), 20);
+    AK_Json_Bench_Run_Into("objects/parse_into", AK_Json_Bench_Buffer_Str(&Telemetry), 20);
+    
+    char Names[500][16];
+    ak_json_str Keys[500];
+    unsigned int Index;
+    for(Index = 0; Index < 500; Index++)
+    {
+        int Length = snprintf(Names[Index], sizeof(Names[Index]), "sensor_%u", Index);
+        Keys[Index] = AK_Json_Str_Create((const ak_json_u8*)Names[Index], (ak_json_u64)Length);
+    }
+    
+    ak_json_context* Context = AK_Json_Create(NULL);
+    ak_json_value* Root = AK_Json_Parse(Context, AK_Json_Bench_Buffer_Str(&Telemetry));
+    ak_json_array* Records = AK_Json_Value_Get_Array(Root);
+    unsigned int RecordCount = AK_Json_Array_Get_Length(Records);
+    
+    clock_t Start = clock();
+    
+    ak_json_u32 Seed = 1;
+    ak_json_u64 Sum = 0;
+    for(Index = 0; Index < 10000000; Index++)
+    {
+        Seed = Seed*1664525 + 1013904223;
+        ak_json_object* Record = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(Records, (Seed >> 9) % RecordCount));
+        Sum += AK_Json_Value_Get_Uint64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Record, Keys[(Seed >> 3) % 500])));
+    }
+    
+    double Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    printf("%-32s %10.2f M lookups/s (checksum %llu)\n", "objects/lookup", Seconds > 0 ? 10.0/Seconds : 0.0, Sum);
+    
+    ak_json_u64 Hashes[500];
+    for(Index = 0; Index < 500; Index++)
+        Hashes[Index] = AK_Json_Hash_Str(Keys[Index]);
+    
+    Start = clock();
+    Seed = 1;
+    Sum = 0;
+    for(Index = 0; Index < 10000000; Index++)
+    {
+        Seed = Seed*1664525 + 1013904223;
+        ak_json_object* Record = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(Records, (Seed >> 9) % RecordCount));
+        unsigned int KeyIndex = (Seed >> 3) % 500;
+        Sum += AK_Json_Value_Get_Uint64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key_Hashed(Record, Keys[KeyIndex], Hashes[KeyIndex])));
+    }
+    
+    Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    printf("%-32s %10.2f M lookups/s (checksum %llu)\n", "objects/lookup_hashed", Seconds > 0 ? 10.0/Seconds : 0.0, Sum);
+    
+    Start = clock();
+    Seed = 1;
+    Sum = 0;
+    for(Index = 0; Index < 10000000; Index++)
+    {
+        Seed = Seed*1664525 + 1013904223;
+        ak_json_object* Record = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(Records, (Seed >> 9) % RecordCount));
+        Sum += AK_Json_Value_Get_Uint64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key_Literal(Record, "sensor_250")));
+    }
+    
+    Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    printf("%-32s %10.2f M lookups/s (checksum %llu)\n", "objects/lookup_literal", Seconds > 0 ? 10.0/Seconds : 0.0, Sum);
+    
+    ak_json_pointer* Pointers[12];
+    for(Index = 0; Index < 12; Index++)
+    {
+        char Path[32];
+        int Length = snprintf(Path, sizeof(Path), "/%u/sensor_%u", (Index*17) % RecordCount, (Index*41) % 500);
+        Pointers[Index] = AK_Json_Pointer_Compile(Context, AK_Json_Str_Create((const ak_json_u8*)Path, (ak_json_u64)Length));
+    }
+    
+    Start = clock();
+    Sum = 0;
+    for(Index = 0; Index < 10000000; Index++)
+        Sum += AK_Json_Value_Get_Uint64(AK_Json_Pointer_Get(Root, Pointers[Index % 12]));
+    
+    Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    printf("%-32s %10.2f M lookups/s (checksum %llu)\n", "objects/pointer", Seconds > 0 ? 10.0/Seconds : 0.0, Sum);
+    
+    AK_Json_Delete(Context);
+    free(Telemetry.Data);
+}
+
+/***********
+*** Tape ***
+************/
+
+//NOTE(EVERYONE): Parse and read two fields out of every record, the access pattern the tape is meant for
+static void AK_Json_Bench_Tape()
+{
+    ak_json_bench_buffer Telemetry = AK_Json_Bench_Build_Telemetry(200, 500);
+    ak_json_str Str = AK_Json_Bench_Buffer_Str(&Telemetry);
+    unsigned int Iterations = 20;
+    
+    clock_t Start = clock();
+    ak_json_u64 Sum = 0;
+    unsigned int Index;
+    for(Index = 0; Index < Iterations; Index++)
+    {
+        ak_json_context* Context = AK_Json_Create(NULL);
+        ak_json_array* Records = AK_Json_Value_Get_Array(AK_Json_Parse(Context, Str));
+        
+        unsigned int RecordIndex;
+        for(RecordIndex = 0; RecordIndex < AK_Json_Array_Get_Length(Records); RecordIndex++)
+        {
+            ak_json_object* Record = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(Records, RecordIndex));
+            Sum += AK_Json_Value_Get_Uint64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Record, AK_Json_Str("sensor_3"))));
+            Sum += AK_Json_Value_Get_Uint64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Record, AK_Json_Str("sensor_250"))));
+        }
+        AK_Json_Delete(Context);
+    }
+    
+    double Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    double Megabytes = ((double)Str.Length*Iterations)/(1024.0*1024.0);
+    printf("%-32s %10.2f MB/s (checksum %llu)\n", "tape/dom_extract", Seconds > 0 ? Megabytes/Seconds : 0.0, Sum);
+    
+    Start = clock();
+    Sum = 0;
+    for(Index = 0; Index < Iterations; Index++)
+    {
+        ak_json_context* Context = AK_Json_Create(NULL);
+        ak_json_cursor Records = AK_Json_Tape_Get_Root(AK_Json_Parse_Tape(Context, Str));
+        
+        ak_json_cursor Record;
+        for(Record = AK_Json_Cursor_Get_First(Records); AK_Json_Cursor_Is_Valid(Record); Record = AK_Json_Cursor_Get_Next(Record))
+        {
+            Sum += AK_Json_Cursor_Get_Uint64(AK_Json_Cursor_Get_Key(Record, AK_Json_Str("sensor_3")));
+            Sum += AK_Json_Cursor_Get_Uint64(AK_Json_Cursor_Get_Key(Record, AK_Json_Str("sensor_250")));
+        }
+        AK_Json_Delete(Context);
+    }
+    
+    Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    printf("%-32s %10.2f MB/s (checksum %llu)\n", "tape/tape_extract", Seconds > 0 ? Megabytes/Seconds : 0.0, Sum);
+    
+    free(Telemetry.Data);
+}
+
+/***********
+*** Lazy ***
+************/
+
+static void AK_Json_Bench_Lazy()
+{
+    ak_json_bench_buffer Telemetry = AK_Json_Bench_Build_Telemetry(200, 500);
+    ak_json_str Str = AK_Json_Bench_Buffer_Str(&Telemetry);
+    unsigned int Iterations = 20;
+    
+    clock_t Start = clock();
+    ak_json_u64 Sum = 0;
+    unsigned int Index;
+    for(Index = 0; Index < Iterations; Index++)
+    {
+        ak_json_context* Context = AK_Json_Create(NULL);
+        ak_json_lazy Records = AK_Json_Parse_Lazy(Context, Str);
+        
+        ak_json_lazy Record;
+        for(Record = AK_Json_Lazy_Get_First(Records); AK_Json_Lazy_Is_Valid(Record); Record = AK_Json_Lazy_Get_Next(Record))
+        {
+            Sum += AK_Json_Lazy_Get_Uint64(AK_Json_Lazy_Get_Key(Record, AK_Json_Str("sensor_3")));
+            Sum += AK_Json_Lazy_Get_Uint64(AK_Json_Lazy_Get_Key(Record, AK_Json_Str("sensor_250")));
+        }
+        AK_Json_Delete(Context);
+    }
+    
+    double Seconds = (double)(clock()-Start)/CLOCKS_PER_SEC;
+    double Megabytes = ((double)Str.Length*Iterations)/(1024.0*1024.0);
+    printf("%-32s %10.2f MB/s (checksum %llu)\n", "lazy/extract", Seconds > 0 ? Megabytes/Seconds : 0.0, Sum);
+    
+    free(Telemetry.Data);
+}
+
+/**************
+*** Scaling ***
+***************/
+
+//NOTE(EVERYONE): Parses record arrays of doubling size up to MaxMegabytes so throughput can be
+//checked for cliffs as inputs grow. Pass a larger limit on the command line (e.g. 6144) to
+//exercise inputs above 4GB
+static void AK_Json_Bench_Scaling(ak_json_u64 MaxMegabytes)
+{
+    ak_json_u64 Megabytes;
+    for(Megabytes = 1; Megabytes <= MaxMegabytes; Megabytes *= 2)
+    {
+        char Name[64];
+        snprintf(Name, sizeof(Name), "scaling/%lluMB", Megabytes);
+
+        ak_json_bench_buffer Records = AK_Json_Bench_Build_Records(Megabytes*1024*1024, 0);
+        if(!Records.Data)
+        {
+            printf("%-32s could not allocate %llu bytes, stopping\n", Name, Megabytes*1024*1024 + 256);
+            break;
+        }
+
+        unsigned int Iterations = Megabytes >= 256 ? 1 : (unsigned int)(256/Megabytes);
+        AK_Json_Bench_Run(Name, AK_Json_Bench_Buffer_Str(&Records), Iterations);
+
+        free(Records.Data);
+    }
+}
+
+int main(int ArgCount, char** Args)
+{
+    ak_json_u64 ScalingMegabytes = ArgCount > 1 ? strtoull(Args[1], NULL, 10) : 64;
+
+    AK_Json_Bench_Whitespace();
+    AK_Json_Bench_Strings();
+    AK_Json_Bench_Numbers();
+    AK_Json_Bench_Arrays();
+    AK_Json_Bench_Objects();
+    AK_Json_Bench_Tape();
+    AK_Json_Bench_Lazy();
+    AK_Json_Bench_Scaling(ScalingMegabytes);
+    return 0;
+}
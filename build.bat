@@ -1,3 +1,4 @@
 @echo off
 
-clang -std=c89 -O0 -g -Wextra -fdiagnostics-absolute-paths -Wno-deprecated-declarations -Wno-unused-parameter tests.c -o tests.exe
\ No newline at end of file
+clang -std=c89 -O0 -g -Wextra -fdiagnostics-absolute-paths -Wno-deprecated-declarations -Wno-unused-parameter tests.c -o tests.exe
+clang -O2 -DNDEBUG -fdiagnostics-absolute-paths -Wno-deprecated-declarations bench.c -o bench.exe
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "ak_json.h"
 
 #include "utest.h"
+#include <math.h>
 
 ak_json_str AK_Json_Test_Read(const char* Path)
 {
@@ -28,7 +29,7 @@ ak_json_str AK_Json_Test_Read(const char* Path)
     return Result;
 }
 
-static void* AK_Json_Test_Null_Allocate(ak_json_allocator* Allocator, unsigned int Size)
+static void* AK_Json_Test_Null_Allocate(ak_json_allocator* Allocator, ak_json_size Size)
 {
     Allocator = Allocator;
     Size = Size;
@@ -41,6 +42,33 @@ static void AK_Json_Test_Free_Stub(ak_json_allocator* Allocator, void* Memory)
     Memory = Memory;
 }
 
+typedef struct ak_json_test_counts
+{
+    unsigned int Allocations;
+    unsigned int Frees;
+} ak_json_test_counts;
+
+static void* AK_Json_Test_Counting_Allocate(ak_json_allocator* Allocator, ak_json_size Size)
+{
+    ((ak_json_test_counts*)Allocator->UserData)->Allocations++;
+    return malloc(Size);
+}
+
+static void AK_Json_Test_Counting_Free(ak_json_allocator* Allocator, void* Memory)
+{
+    ((ak_json_test_counts*)Allocator->UserData)->Frees++;
+    free(Memory);
+}
+
+static ak_json_allocator AK_Json_Test_Counting_Allocator(ak_json_test_counts* Counts)
+{
+    ak_json_allocator Allocator;
+    Allocator.Allocate = AK_Json_Test_Counting_Allocate;
+    Allocator.Free = AK_Json_Test_Counting_Free;
+    Allocator.UserData = (ak_json_user_data)Counts;
+    return Allocator;
+}
+
 UTEST(AK_Json, OutOfMemory)
 {
     ak_json_allocator Allocator;
@@ -92,6 +120,108 @@ UTEST(AK_Json, Simple_Success)
     ASSERT_FALSE(AK_Json_Parse(Context, Json15) == NULL);
     ASSERT_FALSE(AK_Json_Parse(Context, Json16) == NULL);
     
+    ASSERT_TRUE(AK_Json_Value_Get_Boolean(AK_Json_Parse(Context, Json9)));
+    ASSERT_FALSE(AK_Json_Value_Get_Boolean(AK_Json_Parse(Context, Json10)));
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, Json3)), -10.23);
+    
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, String_Decoding)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    
+    ak_json_str Json0 = AK_Json_Str("\"Plain string without escapes\"");
+    ak_json_str Json1 = AK_Json_Str("\"Tab\\t e\\u00e9 \\u20AC \\ud83d\\ude00 \\/\\\"\\\\\"");
+    ak_json_str Json2 = AK_Json_Str("\"\\ud83d lone\"");
+    
+    ak_json_str Expected0 = AK_Json_Str("Plain string without escapes");
+    ak_json_str Expected1 = AK_Json_Str("Tab\t e\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80 /\"\\");
+    ak_json_str Expected2 = AK_Json_Str("\xef\xbf\xbd lone");
+    
+    ak_json_str String0 = AK_Json_Value_Get_String(AK_Json_Parse(Context, Json0));
+    ak_json_str String1 = AK_Json_Value_Get_String(AK_Json_Parse(Context, Json1));
+    ak_json_str String2 = AK_Json_Value_Get_String(AK_Json_Parse(Context, Json2));
+    
+    ASSERT_EQ(String0.Length, Expected0.Length);
+    ASSERT_EQ(strcmp((const char*)String0.Str, (const char*)Expected0.Str), 0);
+    ASSERT_EQ(String1.Length, Expected1.Length);
+    ASSERT_EQ(strcmp((const char*)String1.Str, (const char*)Expected1.Str), 0);
+    ASSERT_EQ(String2.Length, Expected2.Length);
+    ASSERT_EQ(strcmp((const char*)String2.Str, (const char*)Expected2.Str), 0);
+    
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Number_Parsing)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("0.1"))), 0.1);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("-65.613616999999977"))), -65.613616999999977);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("3.141592653589793238462643383279"))), 3.141592653589793);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("1e23"))), 1e23);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("2.2250738585072011e-308"))), 2.2250738585072011e-308);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("4.9e-324"))), 4.9e-324);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("1.7976931348623157e308"))), 1.7976931348623157e308);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("1e-400"))), 0.0);
+    
+    //NOTE(EVERYONE): 2^53+1 is exactly between two doubles, ties go to even unless any later digit is nonzero
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("9007199254740993"))), 9007199254740992.0);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("9007199254740993.000000000000000000000"))), 9007199254740992.0);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("9007199254740993.000000000000000000001"))), 9007199254740994.0);
+    
+    double NegativeZero = AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str("-0")));
+    ASSERT_EQ(NegativeZero, 0.0);
+    ASSERT_TRUE(signbit(NegativeZero));
+    
+    //NOTE(EVERYONE): Only the token span is read, the digits after it are not part of the number
+    const ak_json_u8 Digits[] = "1234";
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Parse(Context, AK_Json_Str_Create(Digits, 2))), 12.0);
+    
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Integer_Values)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    
+    ak_json_value* Value0 = AK_Json_Parse(Context, AK_Json_Str("9007199254740993"));
+    ak_json_value* Value1 = AK_Json_Parse(Context, AK_Json_Str("-9223372036854775808"));
+    ak_json_value* Value2 = AK_Json_Parse(Context, AK_Json_Str("18446744073709551615"));
+    ak_json_value* Value3 = AK_Json_Parse(Context, AK_Json_Str("18446744073709551616"));
+    ak_json_value* Value4 = AK_Json_Parse(Context, AK_Json_Str("-9223372036854775809"));
+    ak_json_value* Value5 = AK_Json_Parse(Context, AK_Json_Str("1.0"));
+    ak_json_value* Value6 = AK_Json_Parse(Context, AK_Json_Str("1e2"));
+    ak_json_value* Value7 = AK_Json_Parse(Context, AK_Json_Str("-0"));
+    ak_json_value* Value8 = AK_Json_Parse(Context, AK_Json_Str("-42"));
+    
+    ASSERT_TRUE(AK_Json_Value_Is_Integer(Value0));
+    ASSERT_EQ(AK_Json_Value_Get_Int64(Value0), 9007199254740993ll);
+    ASSERT_EQ(AK_Json_Value_Get_Uint64(Value0), 9007199254740993ull);
+    ASSERT_EQ(AK_Json_Value_Get_Number(Value0), 9007199254740992.0);
+    
+    ASSERT_TRUE(AK_Json_Value_Is_Integer(Value1));
+    ASSERT_EQ(AK_Json_Value_Get_Int64(Value1), -9223372036854775807ll-1);
+    
+    ASSERT_TRUE(AK_Json_Value_Is_Integer(Value2));
+    ASSERT_EQ(AK_Json_Value_Get_Uint64(Value2), 18446744073709551615ull);
+    ASSERT_EQ(AK_Json_Value_Get_Number(Value2), 18446744073709551615.0);
+    
+    ASSERT_FALSE(AK_Json_Value_Is_Integer(Value3));
+    ASSERT_EQ(AK_Json_Value_Get_Number(Value3), 18446744073709551616.0);
+    ASSERT_FALSE(AK_Json_Value_Is_Integer(Value4));
+    ASSERT_FALSE(AK_Json_Value_Is_Integer(Value5));
+    ASSERT_FALSE(AK_Json_Value_Is_Integer(Value6));
+    ASSERT_EQ(AK_Json_Value_Get_Number(Value6), 100.0);
+    ASSERT_FALSE(AK_Json_Value_Is_Integer(Value7));
+    
+    ASSERT_TRUE(AK_Json_Value_Is_Integer(Value8));
+    ASSERT_EQ(AK_Json_Value_Get_Int64(Value8), -42ll);
+    ASSERT_EQ(AK_Json_Value_Get_Number(Value8), -42.0);
+    
+    ASSERT_FALSE(AK_Json_Value_Is_Integer(AK_Json_Parse(Context, AK_Json_Str("\"42\""))));
+    
     AK_Json_Delete(Context);
 }
 
@@ -102,14 +232,735 @@ UTEST(AK_Json, Simple_Array)
     ak_json_str Json0 = AK_Json_Str("[]");
     ak_json_str Json1 = AK_Json_Str("[123]");
     ak_json_str Json2 = AK_Json_Str("[\"\\uabcd\", 123, null, false, -0.2e4]");
+    ak_json_str Json3 = AK_Json_Str(" [ [1, [2, \"\\/\"]], [], [[ ]] ] ");
     
     ASSERT_FALSE(AK_Json_Parse(Context, Json0) == NULL);
     ASSERT_FALSE(AK_Json_Parse(Context, Json1) == NULL);
     ASSERT_FALSE(AK_Json_Parse(Context, Json2) == NULL);
+    ASSERT_FALSE(AK_Json_Parse(Context, Json3) == NULL);
+    
+    ASSERT_EQ(AK_Json_Array_Get_Length(AK_Json_Value_Get_Array(AK_Json_Parse(Context, Json0))), 0u);
+    
+    ak_json_array* Array2 = AK_Json_Value_Get_Array(AK_Json_Parse(Context, Json2));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Array2), 5u);
+    ASSERT_EQ(AK_Json_Value_Get_Type(AK_Json_Array_Get_Value(Array2, 0)), AK_JSON_VALUE_TYPE_STRING);
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Array_Get_Value(Array2, 1)), 123ll);
+    ASSERT_EQ(AK_Json_Value_Get_Type(AK_Json_Array_Get_Value(Array2, 2)), AK_JSON_VALUE_TYPE_NULL);
+    ASSERT_FALSE(AK_Json_Value_Get_Boolean(AK_Json_Array_Get_Value(Array2, 3)));
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Array_Get_Value(Array2, 4)), -2000.0);
+    
+    ak_json_array* Array3 = AK_Json_Value_Get_Array(AK_Json_Parse(Context, Json3));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Array3), 3u);
+    ak_json_array* Inner = AK_Json_Value_Get_Array(AK_Json_Array_Get_Value(Array3, 0));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Inner), 2u);
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Array_Get_Value(Inner, 0)), 1ll);
+    Inner = AK_Json_Value_Get_Array(AK_Json_Array_Get_Value(Inner, 1));
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Array_Get_Value(Inner, 0)), 2ll);
+    ASSERT_EQ(strcmp((const char*)AK_Json_Value_Get_String(AK_Json_Array_Get_Value(Inner, 1)).Str, "/"), 0);
+    ASSERT_EQ(AK_Json_Array_Get_Length(AK_Json_Value_Get_Array(AK_Json_Array_Get_Value(Array3, 1))), 0u);
+    Inner = AK_Json_Value_Get_Array(AK_Json_Array_Get_Value(Array3, 2));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Inner), 1u);
+    ASSERT_EQ(AK_Json_Array_Get_Length(AK_Json_Value_Get_Array(AK_Json_Array_Get_Value(Inner, 0))), 0u);
+    
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Array_Error)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    
+    ak_json_str Json0 = AK_Json_Str("[1,");
+    ak_json_str Json1 = AK_Json_Str("[1 2]");
+    ak_json_str Json2 = AK_Json_Str("[1, 2");
+    ak_json_str Json3 = AK_Json_Str("[1, 2] 3");
+    ak_json_str Json4 = AK_Json_Str("[\"Hello\nWorld\"]");
+    ak_json_str Json5 = AK_Json_Str("[\"A long string with an invalid \\x escape\"]");
+    
+    ASSERT_EQ(AK_Json_Parse(Context, Json0), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    ASSERT_EQ(AK_Json_Parse(Context, Json1), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    ASSERT_EQ(AK_Json_Parse(Context, Json2), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    ASSERT_EQ(AK_Json_Parse(Context, Json3), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_EXPECTED_END_OF_STREAM);
+    ASSERT_EQ(AK_Json_Parse(Context, Json4), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_UNDEFINED_TOKEN);
+    ASSERT_EQ(AK_Json_Parse(Context, Json5), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_UNDEFINED_TOKEN);
+    
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Max_Depth)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    
+    //NOTE(EVERYONE): Far deeper than any stack could recurse through
+    unsigned int Length = 200*1024;
+    char* Buffer = (char*)malloc(Length);
+    memset(Buffer, '[', Length);
+    ak_json_str Json0 = AK_Json_Str_Create((const ak_json_u8*)Buffer, Length);
+    
+    ASSERT_EQ(AK_Json_Parse(Context, Json0), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    ASSERT_EQ(AK_Json_Parse_Tape(Context, Json0), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    
+    ak_json_u64 Capacity = AK_Json_Max_Memory_For_Input(Length);
+    void* Memory = malloc(Capacity);
+    ASSERT_EQ(AK_Json_Parse_Into(Memory, Capacity, Json0), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    free(Memory);
     
+    memset(Buffer, '{', Length);
+    ASSERT_EQ(AK_Json_Parse(Context, Json0), NULL);
+    ASSERT_NE(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_NONE);
+    
+    //NOTE(EVERYONE): Exactly AK_JSON_MAX_DEPTH levels still parse
+    memset(Buffer, '[', AK_JSON_MAX_DEPTH);
+    memset(Buffer+AK_JSON_MAX_DEPTH, ']', AK_JSON_MAX_DEPTH);
+    ak_json_str Json1 = AK_Json_Str_Create((const ak_json_u8*)Buffer, 2*AK_JSON_MAX_DEPTH);
+    ASSERT_NE(AK_Json_Parse(Context, Json1), NULL);
+    ASSERT_NE(AK_Json_Parse_Tape(Context, Json1), NULL);
+    
+    memset(Buffer, '[', AK_JSON_MAX_DEPTH+1);
+    memset(Buffer+AK_JSON_MAX_DEPTH+1, ']', AK_JSON_MAX_DEPTH+1);
+    ak_json_str Json2 = AK_Json_Str_Create((const ak_json_u8*)Buffer, 2*AK_JSON_MAX_DEPTH+2);
+    ASSERT_EQ(AK_Json_Parse(Context, Json2), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    
+    free(Buffer);
     AK_Json_Delete(Context);
 }
 
+static ak_json_str AK_Json_Test_Build_Large_Array(ak_json_u8* Buffer, unsigned int Count, const char* Element)
+{
+    ak_json_u64 Length = 0;
+    Buffer[Length++] = '[';
+    
+    unsigned int Index;
+    for(Index = 0; Index < Count; Index++)
+    {
+        Length += sprintf((char*)Buffer+Length, "%s\n    %s", Index ? "," : "", Element);
+    }
+    
+    Buffer[Length++] = '\n';
+    Buffer[Length++] = ']';
+    Buffer[Length] = 0;
+    
+    return AK_Json_Str_Create(Buffer, Length);
+}
+
+//NOTE(EVERYONE): An array of Count small objects with an escaped key and string, and one of 100 different 
+//keys in each. 40000 records take a bit under 4MB
+static ak_json_str AK_Json_Test_Build_Records(char* Buffer, unsigned int Count)
+{
+    ak_json_u64 Length = 0;
+    Buffer[Length++] = '[';
+    
+    unsigned int Index;
+    for(Index = 0; Index < Count; Index++)
+    {
+        Length += sprintf(Buffer+Length, "%s{\"id\": %u, \"n\\u0061me\": \"item\\t%u\", \"key_%u\": [1, 2.5, true, null, []]}", 
+                          Index ? "," : "", Index, Index, Index % 100);
+    }
+    
+    Buffer[Length++] = ']';
+    return AK_Json_Str_Create((const ak_json_u8*)Buffer, Length);
+}
+
+UTEST(AK_Json, Simple_Object)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    
+    ak_json_str Json0 = AK_Json_Str("{}");
+    ak_json_str Json1 = AK_Json_Str("{\"a\": 1}");
+    ak_json_str Json2 = AK_Json_Str(" { \"name\" : \"ak\\u006Ason\", \"tags\": [1, {\"\": null}], \"nested\": {\"ok\": true}, \"name\": 2 } ");
+    
+    ak_json_object* Object0 = AK_Json_Value_Get_Object(AK_Json_Parse(Context, Json0));
+    ASSERT_EQ(AK_Json_Object_Get_Key_Count(Object0), 0u);
+    ASSERT_EQ(AK_Json_Object_Get_Key(Object0, AK_Json_Str("a")), NULL);
+    
+    ak_json_object* Object1 = AK_Json_Value_Get_Object(AK_Json_Parse(Context, Json1));
+    ASSERT_EQ(AK_Json_Object_Get_Key_Count(Object1), 1u);
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Object1, AK_Json_Str("a")))), 1ll);
+    
+    ak_json_object* Object2 = AK_Json_Value_Get_Object(AK_Json_Parse(Context, Json2));
+    ASSERT_EQ(AK_Json_Object_Get_Key_Count(Object2), 4u);
+    
+    ak_json_key* Key = AK_Json_Object_Get_Key_By_Index(Object2, 0);
+    ASSERT_EQ(strcmp((const char*)AK_Json_Key_Get_Name(Key).Str, "name"), 0);
+    ASSERT_EQ(strcmp((const char*)AK_Json_Value_Get_String(AK_Json_Key_Get_Value(Key)).Str, "akjson"), 0);
+    
+    //NOTE(EVERYONE): Duplicate keys stay in the key list but lookups return the first one
+    ASSERT_EQ(AK_Json_Object_Get_Key(Object2, AK_Json_Str("name")), Key);
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key_By_Index(Object2, 3))), 2ll);
+    
+    ak_json_array* Tags = AK_Json_Value_Get_Array(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Object2, AK_Json_Str("tags"))));
+    ak_json_object* Empty = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(Tags, 1));
+    ASSERT_EQ(AK_Json_Value_Get_Type(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Empty, AK_Json_Str("")))), AK_JSON_VALUE_TYPE_NULL);
+    
+    ak_json_object* Nested = AK_Json_Value_Get_Object(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Object2, AK_Json_Str("nested"))));
+    ASSERT_TRUE(AK_Json_Value_Get_Boolean(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Nested, AK_Json_Str("ok")))));
+    ASSERT_EQ(AK_Json_Object_Get_Key(Object2, AK_Json_Str("ok")), NULL);
+    ASSERT_EQ(AK_Json_Object_Get_Key(Object2, AK_Json_Str("nam")), NULL);
+    
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Large_Object)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    ak_json_u8* Buffer = (ak_json_u8*)malloc(1024*1024);
+    
+    ak_json_u64 Length = 0;
+    Buffer[Length++] = '{';
+    
+    unsigned int Index;
+    for(Index = 0; Index < 500; Index++)
+        Length += sprintf((char*)Buffer+Length, "%s\"field_%u\": %u", Index ? ", " : "", Index, Index*3);
+    Length += sprintf((char*)Buffer+Length, ", \"field_7\": -1}");
+    
+    ak_json_object* Object = AK_Json_Value_Get_Object(AK_Json_Parse(Context, AK_Json_Str_Create(Buffer, Length)));
+    ASSERT_EQ(AK_Json_Object_Get_Key_Count(Object), 501u);
+    
+    for(Index = 0; Index < 500; Index++)
+    {
+        char Name[32];
+        int NameLength = sprintf(Name, "field_%u", Index);
+        ak_json_key* Key = AK_Json_Object_Get_Key(Object, AK_Json_Str_Create((const ak_json_u8*)Name, (ak_json_u64)NameLength));
+        ASSERT_EQ(Key, AK_Json_Object_Get_Key_By_Index(Object, Index));
+        ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Key_Get_Value(Key)), (ak_json_s64)Index*3);
+    }
+    
+    ASSERT_EQ(AK_Json_Object_Get_Key(Object, AK_Json_Str("field_500")), NULL);
+    ASSERT_EQ(AK_Json_Object_Get_Key(Object, AK_Json_Str("field_")), NULL);
+    
+    ak_json_str Field = AK_Json_Str("field_42");
+    ak_json_u64 Hash = AK_Json_Hash_Str(Field);
+    ASSERT_EQ(AK_Json_Object_Get_Key_Hashed(Object, Field, Hash), AK_Json_Object_Get_Key_By_Index(Object, 42));
+    ASSERT_EQ(AK_Json_Object_Get_Key_Hashed(Object, AK_Json_Str("field_"), AK_Json_Hash_Str(AK_Json_Str("field_"))), NULL);
+    
+    ak_json_object* Small = AK_Json_Value_Get_Object(AK_Json_Parse(Context, AK_Json_Str("{\"field_4\": 1, \"field_42\": 2}")));
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key_Hashed(Small, Field, Hash))), 2);
+    
+    ASSERT_EQ(AK_JSON_HASH_LITERAL("field_42"), Hash);
+    ASSERT_EQ(AK_JSON_HASH_LITERAL(""), AK_Json_Hash_Str(AK_Json_Str("")));
+    ASSERT_EQ(AK_Json_Object_Get_Key_Literal(Object, "field_499"), AK_Json_Object_Get_Key_By_Index(Object, 499));
+    ASSERT_EQ(AK_Json_Object_Get_Key_Literal(Small, "field_4"), AK_Json_Object_Get_Key_By_Index(Small, 0));
+    
+    free(Buffer);
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Key_Interning)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+
+    ak_json_array* Array = AK_Json_Value_Get_Array(AK_Json_Parse(Context, AK_Json_Str("[{\"a\": 1, \"name\": 2}, {\"name\": 3, \"\\u0061\": 4}]")));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Array), 2u);
+
+    ak_json_object* First = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(Array, 0));
+    ak_json_object* Second = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(Array, 1));
+
+    ak_json_str A = AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(First, 0));
+    ak_json_str Name = AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(First, 1));
+    ASSERT_EQ(AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(Second, 0)).Str, Name.Str);
+    ASSERT_EQ(AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(Second, 1)).Str, A.Str);
+    ASSERT_EQ(A.Length, 1u);
+    ASSERT_EQ(A.Str[1], 0);
+
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Second, A))), 4);
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Second, Name))), 3);
+
+    //NOTE(EVERYONE): The key table lives as long as the context
+    ak_json_object* Object = AK_Json_Value_Get_Object(AK_Json_Parse(Context, AK_Json_Str("{\"name\": true}")));
+    ASSERT_EQ(AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(Object, 0)).Str, Name.Str);
+
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Object_Error)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    
+    const char* Errors[] = {"{", "{\"a\"", "{\"a\":", "{\"a\": 1", "{\"a\" 1}", "{1: 2}", "{\"a\": 1,}", 
+                            "{\"a\": 1 \"b\": 2}", "{,}", "{\"a\":: 1}", "[{\"a\": 1]"};
+    
+    unsigned int Index;
+    for(Index = 0; Index < sizeof(Errors)/sizeof(Errors[0]); Index++)
+    {
+        ak_json_str Json = AK_Json_Str_Create((const ak_json_u8*)Errors[Index], strlen(Errors[Index]));
+        ASSERT_EQ(AK_Json_Parse(Context, Json), NULL);
+    }
+    
+    AK_Json_Parse(Context, AK_Json_Str("{\"a\": 1 \"b\": 2}"));
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_OBJECT_PARSING);
+    AK_Json_Parse(Context, AK_Json_Str("{\"a\" 1}"));
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_OBJECT_PARSING);
+    AK_Json_Parse(Context, AK_Json_Str("{\"a\": 1} 2"));
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_EXPECTED_END_OF_STREAM);
+    
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Large_Array)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+    ak_json_u8* Buffer = (ak_json_u8*)malloc(1024*1024);
+    
+    ak_json_str Json0 = AK_Json_Test_Build_Large_Array(Buffer, 1000, "[ \"a\\\\\", \"\\\"[,]\\\"\" , -12.5e3,true,\t null ]");
+    ak_json_value* Value0 = AK_Json_Parse(Context, Json0);
+    ASSERT_FALSE(Value0 == NULL);
+    
+    ak_json_array* Array0 = AK_Json_Value_Get_Array(Value0);
+    ASSERT_EQ(AK_Json_Array_Get_Length(Array0), 1000u);
+    ak_json_array* Last = AK_Json_Value_Get_Array(AK_Json_Array_Get_Value(Array0, 999));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Last), 5u);
+    ASSERT_EQ(AK_Json_Value_Get_String(AK_Json_Array_Get_Value(Last, 1)).Length, 5u);
+    ASSERT_EQ(AK_Json_Value_Get_Number(AK_Json_Array_Get_Value(Last, 2)), -12500.0);
+    
+    ak_json_str Json1 = AK_Json_Test_Build_Large_Array(Buffer, 1000, "[ \"a\\\\\", 1 2 ]");
+    ASSERT_EQ(AK_Json_Parse(Context, Json1), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    
+    ak_json_str Json2 = AK_Json_Test_Build_Large_Array(Buffer, 1000, "[ \"a\\\\\", 12ab ]");
+    ASSERT_EQ(AK_Json_Parse(Context, Json2), NULL);
+    
+    free(Buffer);
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Tape)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+
+    ak_json_tape* Tape = AK_Json_Parse_Tape(Context, AK_Json_Str("[{\"id\": 7, \"skip\": {\"a\": [1, [2, 3], {}]}, \"n\\u0061me\": \"x\\ty\"}, [], -2.5, true, null, 18446744073709551615]"));
+    ASSERT_FALSE(Tape == NULL);
+
+    ak_json_cursor Root = AK_Json_Tape_Get_Root(Tape);
+    ASSERT_EQ(AK_Json_Cursor_Get_Type(Root), AK_JSON_VALUE_TYPE_ARRAY);
+    ASSERT_EQ(AK_Json_Cursor_Get_Length(Root), 6u);
+
+    ak_json_cursor Record = AK_Json_Cursor_Get_Value(Root, 0);
+    ASSERT_EQ(AK_Json_Cursor_Get_Length(Record), 3u);
+    ASSERT_EQ(AK_Json_Cursor_Get_Int64(AK_Json_Cursor_Get_Key(Record, AK_Json_Str("id"))), 7);
+    ASSERT_TRUE(0 == strcmp((const char*)AK_Json_Cursor_Get_String(AK_Json_Cursor_Get_Key(Record, AK_Json_Str("name"))).Str, "x\ty"));
+    ASSERT_FALSE(AK_Json_Cursor_Is_Valid(AK_Json_Cursor_Get_Key(Record, AK_Json_Str("missing"))));
+
+    ak_json_cursor Skip = AK_Json_Cursor_Get_Key(Record, AK_Json_Str("skip"));
+    ak_json_cursor Inner = AK_Json_Cursor_Get_Key(Skip, AK_Json_Str("a"));
+    ASSERT_EQ(AK_Json_Cursor_Get_Uint64(AK_Json_Cursor_Get_Value(AK_Json_Cursor_Get_Value(Inner, 1), 1)), 3u);
+    ASSERT_EQ(AK_Json_Cursor_Get_Length(AK_Json_Cursor_Get_Value(Inner, 2)), 0u);
+
+    ak_json_cursor Empty = AK_Json_Cursor_Get_Value(Root, 1);
+    ASSERT_FALSE(AK_Json_Cursor_Is_Valid(AK_Json_Cursor_Get_First(Empty)));
+
+    ak_json_cursor Cursor = AK_Json_Cursor_Get_Next(Empty);
+    ASSERT_EQ(AK_Json_Cursor_Get_Number(Cursor), -2.5);
+    Cursor = AK_Json_Cursor_Get_Next(Cursor);
+    ASSERT_EQ(AK_Json_Cursor_Get_Boolean(Cursor), 1);
+    Cursor = AK_Json_Cursor_Get_Next(Cursor);
+    ASSERT_EQ(AK_Json_Cursor_Get_Type(Cursor), AK_JSON_VALUE_TYPE_NULL);
+    Cursor = AK_Json_Cursor_Get_Next(Cursor);
+    ASSERT_EQ(AK_Json_Cursor_Get_Uint64(Cursor), 18446744073709551615ull);
+    ASSERT_FALSE(AK_Json_Cursor_Is_Valid(AK_Json_Cursor_Get_Next(Cursor)));
+    ASSERT_FALSE(AK_Json_Cursor_Is_Valid(AK_Json_Cursor_Get_Next(Root)));
+
+    ak_json_tape* Scalar = AK_Json_Parse_Tape(Context, AK_Json_Str(" \"\" "));
+    ASSERT_EQ(AK_Json_Cursor_Get_String(AK_Json_Tape_Get_Root(Scalar)).Length, 0u);
+
+    ASSERT_TRUE(AK_Json_Parse_Tape(Context, AK_Json_Str("[1, {\"a\" 2}]")) == NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_OBJECT_PARSING);
+    ASSERT_TRUE(AK_Json_Parse_Tape(Context, AK_Json_Str("[1, 2] 3")) == NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_EXPECTED_END_OF_STREAM);
+
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Lazy)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+
+    ak_json_lazy Root = AK_Json_Parse_Lazy(Context, AK_Json_Str(" [{\"skip\": {\"a\": [\"]}\", [2, 3], {}]}, \"id\" : 7, \"n\\u0061me\": \"x\\ty\", \"t\": \"plain\"}, [], -2.5, true, null, 18446744073709551615] "));
+    ASSERT_TRUE(AK_Json_Lazy_Is_Valid(Root));
+    ASSERT_EQ(AK_Json_Lazy_Get_Type(Root), AK_JSON_VALUE_TYPE_ARRAY);
+
+    ak_json_lazy Record = AK_Json_Lazy_Get_Value(Root, 0);
+    ASSERT_EQ(AK_Json_Lazy_Get_Int64(AK_Json_Lazy_Get_Key(Record, AK_Json_Str("id"))), 7);
+    ASSERT_TRUE(0 == strcmp((const char*)AK_Json_Lazy_Get_String(AK_Json_Lazy_Get_Key(Record, AK_Json_Str("name"))).Str, "x\ty"));
+    ak_json_str Plain = AK_Json_Lazy_Get_String(AK_Json_Lazy_Get_Key(Record, AK_Json_Str("t")));
+    ASSERT_EQ(Plain.Length, 5u);
+    ASSERT_TRUE(0 == memcmp(Plain.Str, "plain", 5));
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Lazy_Get_Key(Record, AK_Json_Str("missing"))));
+
+    ak_json_lazy Inner = AK_Json_Lazy_Get_Key(AK_Json_Lazy_Get_Key(Record, AK_Json_Str("skip")), AK_Json_Str("a"));
+    ASSERT_EQ(AK_Json_Lazy_Get_String(AK_Json_Lazy_Get_Value(Inner, 0)).Length, 2u);
+    ASSERT_EQ(AK_Json_Lazy_Get_Uint64(AK_Json_Lazy_Get_Value(AK_Json_Lazy_Get_Value(Inner, 1), 1)), 3u);
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Lazy_Get_First(AK_Json_Lazy_Get_Value(Inner, 2))));
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Lazy_Get_Value(Inner, 3)));
+
+    ak_json_lazy Empty = AK_Json_Lazy_Get_Value(Root, 1);
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Lazy_Get_First(Empty)));
+
+    ak_json_lazy Lazy = AK_Json_Lazy_Get_Next(Empty);
+    ASSERT_EQ(AK_Json_Lazy_Get_Number(Lazy), -2.5);
+    ASSERT_FALSE(AK_Json_Lazy_Is_Integer(Lazy));
+    Lazy = AK_Json_Lazy_Get_Next(Lazy);
+    ASSERT_EQ(AK_Json_Lazy_Get_Boolean(Lazy), 1);
+    Lazy = AK_Json_Lazy_Get_Next(Lazy);
+    ASSERT_EQ(AK_Json_Lazy_Get_Type(Lazy), AK_JSON_VALUE_TYPE_NULL);
+    Lazy = AK_Json_Lazy_Get_Next(Lazy);
+    ASSERT_EQ(AK_Json_Lazy_Get_Uint64(Lazy), 18446744073709551615ull);
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Lazy_Get_Next(Lazy)));
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Lazy_Get_Next(Root)));
+
+    //NOTE(EVERYONE): Errors only show up in the parts that are touched
+    ak_json_lazy Broken = AK_Json_Parse_Lazy(Context, AK_Json_Str("[[1, 2 3], 4 5]"));
+    ASSERT_EQ(AK_Json_Lazy_Get_Int64(AK_Json_Lazy_Get_Value(Broken, 1)), 4);
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Lazy_Get_Value(Broken, 2)));
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Lazy_Get_Key(AK_Json_Parse_Lazy(Context, AK_Json_Str("{\"a\" 1}")), AK_Json_Str("a"))));
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_OBJECT_PARSING);
+    ASSERT_FALSE(AK_Json_Lazy_Is_Valid(AK_Json_Parse_Lazy(Context, AK_Json_Str("  "))));
+
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Pointer)
+{
+    ak_json_context* Context = AK_Json_Create(NULL);
+
+    //NOTE(EVERYONE): The examples from RFC 6901 section 5
+    ak_json_value* Root = AK_Json_Parse(Context, AK_Json_Str("{\"foo\": [\"bar\", \"baz\"], \"\": 0, \"a/b\": 1, \"c%d\": 2, \"e^f\": 3, "
+                                                              "\"g|h\": 4, \"i\\\\j\": 5, \"k\\\"l\": 6, \" \": 7, \"m~n\": 8, \"01\": 9}"));
+    ASSERT_NE(Root, NULL);
+
+    ASSERT_EQ(AK_Json_Pointer_Get(Root, AK_Json_Pointer_Compile(Context, AK_Json_Str(""))), Root);
+    ak_json_value* Foo = AK_Json_Pointer_Get(Root, AK_Json_Pointer_Compile(Context, AK_Json_Str("/foo")));
+    ASSERT_EQ(AK_Json_Value_Get_Type(Foo), AK_JSON_VALUE_TYPE_ARRAY);
+    ASSERT_EQ(AK_Json_Value_Get_String(AK_Json_Pointer_Get(Root, AK_Json_Pointer_Compile(Context, AK_Json_Str("/foo/0")))).Length, 3u);
+
+    const char* Paths[] = {"/", "/a~1b", "/c%d", "/e^f", "/g|h", "/i\\j", "/k\"l", "/ ", "/m~0n", "/01"};
+    unsigned int Index;
+    for(Index = 0; Index < sizeof(Paths)/sizeof(Paths[0]); Index++)
+    {
+        ak_json_pointer* Pointer = AK_Json_Pointer_Compile(Context, AK_Json_Str_Create((const ak_json_u8*)Paths[Index], strlen(Paths[Index])));
+        ASSERT_NE(Pointer, NULL);
+        ASSERT_EQ(AK_Json_Value_Get_Uint64(AK_Json_Pointer_Get(Root, Pointer)), Index);
+    }
+
+    ak_json_pointer* Baz = AK_Json_Pointer_Compile(Context, AK_Json_Str("/foo/1"));
+    ASSERT_EQ(AK_Json_Pointer_Get(Root, Baz), AK_Json_Array_Get_Value(AK_Json_Value_Get_Array(Foo), 1));
+    ASSERT_EQ(AK_Json_Pointer_Get(Root, AK_Json_Pointer_Compile(Context, AK_Json_Str("/foo/2"))), NULL);
+    ASSERT_EQ(AK_Json_Pointer_Get(Root, AK_Json_Pointer_Compile(Context, AK_Json_Str("/foo/-"))), NULL);
+    ASSERT_EQ(AK_Json_Pointer_Get(Root, AK_Json_Pointer_Compile(Context, AK_Json_Str("/foo/01"))), NULL);
+    ASSERT_EQ(AK_Json_Pointer_Get(Root, AK_Json_Pointer_Compile(Context, AK_Json_Str("/foo/0/x"))), NULL);
+    ASSERT_EQ(AK_Json_Pointer_Get(Root, AK_Json_Pointer_Compile(Context, AK_Json_Str("/missing"))), NULL);
+
+    //NOTE(EVERYONE): A compiled pointer works on any document, including ones from other contexts
+    ak_json_context* Other = AK_Json_Create(NULL);
+    ak_json_value* Document = AK_Json_Parse(Other, AK_Json_Str("{\"foo\": [1, 2]}"));
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Pointer_Get(Document, Baz)), 2);
+    AK_Json_Delete(Other);
+
+    ASSERT_EQ(AK_Json_Pointer_Compile(Context, AK_Json_Str("foo")), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_POINTER_PARSING);
+    ASSERT_EQ(AK_Json_Pointer_Compile(Context, AK_Json_Str("/a~2")), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_POINTER_PARSING);
+    ASSERT_EQ(AK_Json_Pointer_Compile(Context, AK_Json_Str("/a~")), NULL);
+
+    AK_Json_Delete(Context);
+}
+
+UTEST(AK_Json, Context_Reset)
+{
+    ak_json_test_counts Counts = {0, 0};
+    ak_json_allocator Allocator = AK_Json_Test_Counting_Allocator(&Counts);
+
+    //NOTE(EVERYONE): Big enough to spill out of the first arena block
+    char* Buffer = (char*)malloc(4*1024*1024);
+    ak_json_str Str = AK_Json_Test_Build_Records(Buffer, 40000);
+
+    ak_json_context* Context = AK_Json_Create(&Allocator);
+    ak_json_value* Root = AK_Json_Parse(Context, Str);
+    ASSERT_NE(Root, NULL);
+
+    unsigned int Iteration;
+    for(Iteration = 0; Iteration < 3; Iteration++)
+    {
+        AK_Json_Context_Reset(Context, 0);
+#ifndef AK_JSON_TWO_PASS_PARSER
+        unsigned int Allocations = Counts.Allocations;
+#endif
+        Root = AK_Json_Parse(Context, Str);
+        ASSERT_NE(Root, NULL);
+#ifndef AK_JSON_TWO_PASS_PARSER
+        //NOTE(EVERYONE): The two pass parser still allocates its token tape on every parse
+        ASSERT_EQ(Counts.Allocations, Allocations);
+#endif
+
+        ak_json_object* Last = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(AK_Json_Value_Get_Array(Root), 39999));
+        ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Last, AK_Json_Str("id")))), 39999);
+        ASSERT_NE(AK_Json_Object_Get_Key(Last, AK_Json_Str("key_99")), NULL);
+    }
+
+    //NOTE(EVERYONE): Keys from before the reset are gone, so the first use of a key interns it again
+    AK_Json_Context_Reset(Context, 0);
+    Root = AK_Json_Parse(Context, AK_Json_Str("{\"key_5\": {\"key_5\": 1}}"));
+    ak_json_key* Outer = AK_Json_Object_Get_Key_By_Index(AK_Json_Value_Get_Object(Root), 0);
+    ak_json_key* Inner = AK_Json_Object_Get_Key_By_Index(AK_Json_Value_Get_Object(AK_Json_Key_Get_Value(Outer)), 0);
+    ASSERT_EQ(AK_Json_Key_Get_Name(Outer).Str, AK_Json_Key_Get_Name(Inner).Str);
+
+    unsigned int Frees = Counts.Frees;
+    AK_Json_Context_Reset(Context, 1024);
+    ASSERT_GT(Counts.Frees, Frees);
+    Root = AK_Json_Parse(Context, AK_Json_Str("[1, 2]"));
+    ASSERT_EQ(AK_Json_Array_Get_Length(AK_Json_Value_Get_Array(Root)), 2u);
+
+    AK_Json_Delete(Context);
+    ASSERT_EQ(Counts.Allocations, Counts.Frees);
+    free(Buffer);
+}
+
+UTEST(AK_Json, Document)
+{
+    ak_json_test_counts Counts = {0, 0};
+    ak_json_allocator Allocator = AK_Json_Test_Counting_Allocator(&Counts);
+
+    ak_json_context* Context = AK_Json_Create(&Allocator);
+    ak_json_document* Documents[8];
+    unsigned int Index;
+    for(Index = 0; Index < 8; Index++)
+    {
+        char Buffer[64];
+        int Length = sprintf(Buffer, "{\"id\": %u, \"tags\": [\"a\", \"b\\u0063\"]}", Index);
+        Documents[Index] = AK_Json_Parse_Document(Context, AK_Json_Str_Create((const ak_json_u8*)Buffer, (ak_json_u64)Length));
+        ASSERT_NE(Documents[Index], NULL);
+    }
+
+    //NOTE(EVERYONE): Freeing a document returns its memory right away and leaves the others alone
+    unsigned int Frees = Counts.Frees;
+    for(Index = 0; Index < 8; Index += 2)
+        AK_Json_Document_Free(Documents[Index]);
+    ASSERT_GT(Counts.Frees, Frees);
+
+    for(Index = 1; Index < 8; Index += 2)
+    {
+        ak_json_object* Object = AK_Json_Value_Get_Object(AK_Json_Document_Get_Root(Documents[Index]));
+        ASSERT_EQ(AK_Json_Value_Get_Uint64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Object, AK_Json_Str("id")))), Index);
+        ak_json_array* Tags = AK_Json_Value_Get_Array(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Object, AK_Json_Str("tags"))));
+        ASSERT_TRUE(0 == strcmp((const char*)AK_Json_Value_Get_String(AK_Json_Array_Get_Value(Tags, 1)).Str, "bc"));
+    }
+
+    //NOTE(EVERYONE): Keys are interned per document, so they are shared inside a document but not between them
+    ak_json_object* Object1 = AK_Json_Value_Get_Object(AK_Json_Document_Get_Root(Documents[1]));
+    ak_json_object* Object3 = AK_Json_Value_Get_Object(AK_Json_Document_Get_Root(Documents[3]));
+    ASSERT_NE(AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(Object1, 0)).Str, AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(Object3, 0)).Str);
+    ASSERT_EQ(AK_Json_Object_Get_Key(Object3, AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(Object1, 1))), AK_Json_Object_Get_Key_By_Index(Object3, 1));
+
+    //NOTE(EVERYONE): Once warmed up, parsing documents and failing to parse them leaves nothing behind in the context
+    AK_Json_Document_Free(AK_Json_Parse_Document(Context, AK_Json_Str("{\"other\": [1, 2], \"id\": 0}")));
+    unsigned int Live = Counts.Allocations-Counts.Frees;
+    for(Index = 0; Index < 64; Index++)
+    {
+        AK_Json_Document_Free(AK_Json_Parse_Document(Context, AK_Json_Str("{\"other\": [1, 2], \"id\": 0}")));
+        ASSERT_EQ(AK_Json_Parse_Document(Context, AK_Json_Str("[1, 2")), NULL);
+        ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+        ASSERT_EQ(Counts.Allocations-Counts.Frees, Live);
+    }
+
+    //NOTE(EVERYONE): Documents don't depend on the context after parsing
+    AK_Json_Context_Reset(Context, 0);
+    AK_Json_Delete(Context);
+    for(Index = 1; Index < 8; Index += 2)
+    {
+        ak_json_object* Object = AK_Json_Value_Get_Object(AK_Json_Document_Get_Root(Documents[Index]));
+        ASSERT_EQ(AK_Json_Value_Get_Uint64(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Object, AK_Json_Str("id")))), Index);
+        AK_Json_Document_Free(Documents[Index]);
+    }
+    ASSERT_EQ(Counts.Allocations, Counts.Frees);
+}
+
+UTEST(AK_Json, Prepass)
+{
+    ak_json_test_counts Counts = {0, 0};
+    ak_json_allocator Allocator = AK_Json_Test_Counting_Allocator(&Counts);
+
+    char* Buffer = (char*)malloc(4*1024*1024);
+    ak_json_str Str = AK_Json_Test_Build_Records(Buffer, 40000);
+
+    ak_json_context* Context = AK_Json_Create(&Allocator);
+    AK_Json_Document_Free(AK_Json_Parse_Document(Context, Str));
+
+    //NOTE(EVERYONE): Once the context has its scratch memory, a large document is a single allocation that 
+    //holds its arena and the whole DOM
+    unsigned int Allocations = Counts.Allocations;
+    ak_json_document* Document = AK_Json_Parse_Document(Context, Str);
+    ASSERT_NE(Document, NULL);
+    ASSERT_EQ(Counts.Allocations, Allocations+1);
+
+    ak_json_array* Array = AK_Json_Value_Get_Array(AK_Json_Document_Get_Root(Document));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Array), 40000u);
+    ak_json_object* Last = AK_Json_Value_Get_Object(AK_Json_Array_Get_Value(Array, 39999));
+    ASSERT_TRUE(0 == strcmp((const char*)AK_Json_Value_Get_String(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Last, AK_Json_Str("name")))).Str, "item\t39999"));
+
+    //NOTE(EVERYONE): Broken input skips the prepass and still reports the parser's error
+    Buffer[Str.Length-1] = '}';
+    ASSERT_EQ(AK_Json_Parse_Document(Context, Str), NULL);
+    ASSERT_NE(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_NONE);
+
+    AK_Json_Document_Free(Document);
+    AK_Json_Delete(Context);
+    ASSERT_EQ(Counts.Allocations, Counts.Frees);
+    free(Buffer);
+}
+
+UTEST(AK_Json, Arena_Growth)
+{
+    ak_json_test_counts Counts = {0, 0};
+    ak_json_allocator Allocator = AK_Json_Test_Counting_Allocator(&Counts);
+
+    //NOTE(EVERYONE): Small enough to skip the prepass, while the DOM is about eight times the input
+    char* Buffer = (char*)malloc(256*1024);
+    unsigned int Length = 0;
+    unsigned int Index;
+    Buffer[Length++] = '[';
+    for(Index = 0; Index < 100; Index++)
+    {
+        Buffer[Length++] = '[';
+        unsigned int Element;
+        for(Element = 0; Element < 1000; Element++)
+        {
+            Buffer[Length++] = '1';
+            Buffer[Length++] = ',';
+        }
+        Buffer[Length-1] = ']';
+        Buffer[Length++] = ',';
+        if(Index == 50)
+        {
+            Buffer[Length++] = '"';
+            memset(Buffer+Length, 'x', 32*1024);
+            Length += 32*1024;
+            Buffer[Length++] = '"';
+            Buffer[Length++] = ',';
+        }
+    }
+    Buffer[Length-1] = ']';
+    ak_json_str Str = AK_Json_Str_Create((const ak_json_u8*)Buffer, Length);
+
+    ak_json_context* Context = AK_Json_Create(&Allocator);
+    AK_Json_Document_Free(AK_Json_Parse_Document(Context, Str));
+
+    //NOTE(EVERYONE): Blocks double in size, so 1.6MB of values in a 230KB document only takes a few of them
+    //instead of one block per 230KB
+#if !defined(AK_JSON_TWO_PASS_PARSER) && AK_JSON_ARENA_MAX_BLOCK_SIZE >= 1024*1024
+    unsigned int Allocations = Counts.Allocations;
+#endif
+    ak_json_document* Document = AK_Json_Parse_Document(Context, Str);
+    ASSERT_NE(Document, NULL);
+#if !defined(AK_JSON_TWO_PASS_PARSER) && AK_JSON_ARENA_MAX_BLOCK_SIZE >= 1024*1024
+    ASSERT_LE(Counts.Allocations, Allocations+4);
+#endif
+
+    ak_json_array* Array = AK_Json_Value_Get_Array(AK_Json_Document_Get_Root(Document));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Array), 101u);
+    ASSERT_EQ(AK_Json_Value_Get_String(AK_Json_Array_Get_Value(Array, 51)).Length, 32u*1024u);
+    ak_json_array* Last = AK_Json_Value_Get_Array(AK_Json_Array_Get_Value(Array, 100));
+    ASSERT_EQ(AK_Json_Array_Get_Length(Last), 1000u);
+    ASSERT_EQ(AK_Json_Value_Get_Int64(AK_Json_Array_Get_Value(Last, 999)), 1);
+
+    AK_Json_Document_Free(Document);
+    AK_Json_Delete(Context);
+    ASSERT_EQ(Counts.Allocations, Counts.Frees);
+    free(Buffer);
+}
+
+static int AK_Json_Test_Is_In_Buffer(const void* Pointer, const char* Buffer, ak_json_u64 Capacity)
+{
+    return (const char*)Pointer >= Buffer && (const char*)Pointer < Buffer+Capacity;
+}
+
+UTEST(AK_Json, Parse_Into)
+{
+    ak_json_str Json = AK_Json_Str("{\"name\": \"sensor\", \"tags\": [\"a\", \"b\\u0063\"], \"values\": [1, 2.5, true, null]}");
+    ak_json_u64 MaxCapacity = AK_Json_Max_Memory_For_Input(Json.Length);
+
+    //NOTE(EVERYONE): Every buffer either holds the whole parse or fails cleanly, and never gets written past
+    ak_json_u64 Capacity;
+    ak_json_u64 MinCapacity = 0;
+    for(Capacity = 0; Capacity <= MaxCapacity && !MinCapacity; Capacity++)
+    {
+        char* Buffer = (char*)malloc(Capacity ? Capacity : 1);
+        ak_json_value* Root = AK_Json_Parse_Into(Buffer, Capacity, Json);
+        free(Buffer);
+        if(Root)
+        {
+            MinCapacity = Capacity;
+        }
+        else
+        {
+            ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_OUT_OF_MEMORY);
+        }
+    }
+    ASSERT_NE(MinCapacity, 0u);
+
+    char* Buffer = (char*)malloc(MinCapacity);
+    ak_json_value* Root = AK_Json_Parse_Into(Buffer, MinCapacity, Json);
+    ASSERT_TRUE(AK_Json_Test_Is_In_Buffer(Root, Buffer, MinCapacity));
+    ak_json_object* Object = AK_Json_Value_Get_Object(Root);
+    ak_json_str Name = AK_Json_Value_Get_String(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Object, AK_Json_Str("name"))));
+    ASSERT_TRUE(AK_Json_Test_Is_In_Buffer(Name.Str, Buffer, MinCapacity));
+    ASSERT_TRUE(0 == strcmp((const char*)Name.Str, "sensor"));
+    ak_json_array* Tags = AK_Json_Value_Get_Array(AK_Json_Key_Get_Value(AK_Json_Object_Get_Key(Object, AK_Json_Str("tags"))));
+    ASSERT_TRUE(0 == strcmp((const char*)AK_Json_Value_Get_String(AK_Json_Array_Get_Value(Tags, 1)).Str, "bc"));
+    ASSERT_TRUE(AK_Json_Test_Is_In_Buffer(AK_Json_Key_Get_Name(AK_Json_Object_Get_Key_By_Index(Object, 2)).Str, Buffer, MinCapacity));
+    free(Buffer);
+
+    //NOTE(EVERYONE): Parse errors still come through as themselves
+    char Small[4096];
+    ASSERT_EQ(AK_Json_Parse_Into(Small, sizeof(Small), AK_Json_Str("[1, 2")), NULL);
+    ASSERT_EQ(AK_Json_Get_Error_Code(), AK_JSON_ERROR_CODE_ARRAY_PARSING);
+
+    //NOTE(EVERYONE): The worst case inputs for each part of the bound fit in exactly that much memory
+    const char* Patterns[] = {"1,", "\"\",", "[],", "{\"k%u\":1},", "{\"\\u0041%u\":\"x\"},"};
+    unsigned int PatternIndex;
+    for(PatternIndex = 0; PatternIndex < sizeof(Patterns)/sizeof(Patterns[0]); PatternIndex++)
+    {
+        char* Input = (char*)malloc(128*1024);
+        unsigned int Length = 0;
+        unsigned int Index;
+        Input[Length++] = '[';
+        for(Index = 0; Length < 100*1024; Index++)
+            Length += (unsigned int)sprintf(Input+Length, Patterns[PatternIndex], Index);
+        Input[Length-1] = ']';
+
+        ak_json_str Str = AK_Json_Str_Create((const ak_json_u8*)Input, Length);
+        Capacity = AK_Json_Max_Memory_For_Input(Length);
+        Buffer = (char*)malloc(Capacity);
+        ASSERT_NE(AK_Json_Parse_Into(Buffer, Capacity, Str), NULL);
+        free(Buffer);
+        free(Input);
+    }
+
+    //NOTE(EVERYONE): As do objects with many unique keys, which hit the key slots and hash index hardest
+    char* Input = (char*)malloc(128*1024);
+    unsigned int Length = 0;
+    unsigned int Index;
+    Input[Length++] = '{';
+    for(Index = 0; Length < 100*1024; Index++)
+        Length += (unsigned int)sprintf(Input+Length, "\"%x\":0,", Index);
+    Input[Length-1] = '}';
+    Capacity = AK_Json_Max_Memory_For_Input(Length);
+    Buffer = (char*)malloc(Capacity);
+    Root = AK_Json_Parse_Into(Buffer, Capacity, AK_Json_Str_Create((const ak_json_u8*)Input, Length));
+    ASSERT_NE(Root, NULL);
+    ASSERT_EQ(AK_Json_Object_Get_Key_Count(AK_Json_Value_Get_Object(Root)), Index);
+    free(Buffer);
+    free(Input);
+}
+
 UTEST(AK_Json, Simple_Error)
 {
     ak_json_context* Context = AK_Json_Create(NULL);
@@ -119,6 +970,36 @@ UTEST(AK_Json, Simple_Error)
     
     printf("%s", (const char*)AK_Json_Get_Error_Message().Str);
     
+    ak_json_str Json1 = AK_Json_Str("[\r\n\t1,\r\n\t2 3\r\n]");
+    ASSERT_EQ(AK_Json_Parse(Context, Json1), NULL);
+    
+    ak_json_str ErrorMessage = AK_Json_Str("Error: Error parsing array. Expected , or ] characters.\n"
+                                           "2 \t1,\n"
+                                           "3 \t2 3\n"
+                                           "  \t  ^");
+    ASSERT_EQ(AK_Json_Get_Error_Message().Length, ErrorMessage.Length);
+    ASSERT_EQ(strcmp((const char*)AK_Json_Get_Error_Message().Str, (const char*)ErrorMessage.Str), 0);
+    
+    //NOTE(EVERYONE): Only a window of a long line ends up in the message, with the caret still under the error
+    char* Long = (char*)malloc(100003);
+    Long[0] = '[';
+    unsigned int Index;
+    for(Index = 0; Index < 50000; Index++)
+    {
+        Long[1+Index*2] = '1';
+        Long[2+Index*2] = ',';
+    }
+    Long[1+30000*2] = 'x';
+    Long[100001] = ']';
+    Long[100002] = 0;
+    ASSERT_EQ(AK_Json_Parse(Context, AK_Json_Str_Create((const ak_json_u8*)Long, 100002)), NULL);
+    ak_json_str Message = AK_Json_Get_Error_Message();
+    ASSERT_LT(Message.Length, 1024u);
+    const char* Caret = strchr((const char*)Message.Str, '^');
+    const char* Line = strstr((const char*)Message.Str, "\n1 ")+3;
+    ASSERT_EQ(Line[Caret-strrchr((const char*)Message.Str, '\n')-1-2], 'x');
+    free(Long);
+    
     AK_Json_Delete(Context);
 }
 